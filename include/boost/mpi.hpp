@@ -19,18 +19,33 @@
 #ifndef BOOST_MPI_HPP
 #define BOOST_MPI_HPP
 
+#include <boost/mpi/active_messages.hpp>
+#include <boost/mpi/aggregator.hpp>
 #include <boost/mpi/allocator.hpp>
+#include <boost/mpi/collective_plan.hpp>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/mpi/completion_queue.hpp>
+#include <boost/mpi/coroutine.hpp>
 #include <boost/mpi/datatype.hpp>
+#include <boost/mpi/dist_graph_communicator.hpp>
+#include <boost/mpi/distributed_array.hpp>
 #include <boost/mpi/optional.hpp>
 #include <boost/mpi/environment.hpp>
+#include <boost/mpi/file.hpp>
 #include <boost/mpi/graph_communicator.hpp>
 #include <boost/mpi/group.hpp>
 #include <boost/mpi/intercommunicator.hpp>
 #include <boost/mpi/nonblocking.hpp>
 #include <boost/mpi/operations.hpp>
+#include <boost/mpi/progress.hpp>
+#include <boost/mpi/shared_window.hpp>
 #include <boost/mpi/skeleton_and_content.hpp>
+#include <boost/mpi/submission_queue.hpp>
+#include <boost/mpi/task_pool.hpp>
+#include <boost/mpi/termination_detector.hpp>
 #include <boost/mpi/timer.hpp>
+#include <boost/mpi/wait_policy.hpp>
+#include <boost/mpi/window.hpp>
 
 #endif // BOOST_MPI_HPP
@@ -0,0 +1,304 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file active_messages.hpp
+ *
+ *  This header defines the @c active_messages class, which sends
+ *  messages that run a handler, registered beforehand, on arrival.
+ */
+#ifndef BOOST_MPI_ACTIVE_MESSAGES_HPP
+#define BOOST_MPI_ACTIVE_MESSAGES_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/detail/mpi_datatype_cache.hpp>
+#include <boost/mpi/detail/packed_batch.hpp>
+#include <boost/function.hpp>
+#include <cstddef>
+#include <map>
+#include <typeinfo>
+#include <vector>
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && !defined(BOOST_NO_CXX11_HDR_TUPLE) \
+  && !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS) && !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+#  define BOOST_MPI_HAS_TYPED_ACTIVE_MESSAGES 1
+#  include <tuple>
+#  include <type_traits>
+#  include <utility>
+#endif
+
+namespace boost { namespace mpi {
+
+class active_messages;
+
+#if defined(BOOST_MPI_HAS_TYPED_ACTIVE_MESSAGES)
+namespace detail {
+  template<std::size_t... I> struct am_indices {};
+
+  template<std::size_t N, std::size_t... I>
+  struct make_am_indices : make_am_indices<N - 1, N - 1, I...> {};
+
+  template<std::size_t... I>
+  struct make_am_indices<0, I...> { typedef am_indices<I...> type; };
+
+  /**
+   * The arguments of a handler called as @c h(source, args...), from
+   * the type of its call operator.
+   */
+  template<typename F>
+  struct am_signature;
+
+  template<typename C, typename... A>
+  struct am_signature<void (C::*)(int, A...)>
+  {
+    typedef std::tuple<typename std::decay<A>::type...> arguments;
+  };
+
+  template<typename C, typename... A>
+  struct am_signature<void (C::*)(int, A...) const>
+    : am_signature<void (C::*)(int, A...)> {};
+
+  template<typename Handler>
+  struct am_arguments
+    : am_signature<decltype(&Handler::operator())> {};
+
+  /**
+   * Unpacks the arguments of a typed handler, and calls it.
+   */
+  template<typename Handler>
+  struct typed_am_handler
+  {
+    typedef typename am_arguments<Handler>::arguments arguments;
+
+    explicit typed_am_handler(const Handler& h) : m_handler(h) {}
+
+    void operator()(int source, packed_iarchive& ar)
+    {
+      arguments args;
+      call(source, ar, args,
+           typename make_am_indices<std::tuple_size<arguments>::value>::type());
+    }
+
+    template<std::size_t... I>
+    void call(int source, packed_iarchive& ar, arguments& args, am_indices<I...>)
+    {
+      int unpack[] = { 0, (ar >> std::get<I>(args), 0)... };
+      (void)unpack;
+      m_handler(source, std::get<I>(args)...);
+    }
+
+    Handler m_handler;
+  };
+
+  template<typename Arguments, typename... Args, std::size_t... I>
+  void
+  pack_am_arguments(packed_oarchive& ar, am_indices<I...>, Args&&... args)
+  {
+    // Pack each argument as the type the handler takes.
+    int pack[] = {
+      0, (ar << static_cast<const typename std::tuple_element<I, Arguments>::type&>(args), 0)...
+    };
+    (void)pack;
+  }
+} // end namespace detail
+#endif // BOOST_MPI_HAS_TYPED_ACTIVE_MESSAGES
+
+/**
+ * @brief Messages that run a handler on arrival.
+ *
+ * An @c active_messages object sends messages that each name a
+ * handler, registered beforehand on every process, and carry its
+ * arguments. The receiving process runs the handler, with the source
+ * and the deserialized arguments, when it calls @c progress. Handlers
+ * may post messages themselves, to answer a request for instance.
+ *
+ * Messages posted to the same destination are packed together, and
+ * sent as one MPI message when they reach a number of bytes, or when
+ * the program calls @c flush or @c progress. Receiving uses matched
+ * probes (@c MPI_Improbe and @c MPI_Mrecv) where MPI supports them,
+ * so that several threads using different objects do not steal each
+ * other's messages.
+ *
+ * Handlers are identified by an integer id. The low-level ones, given
+ * with their id, read their arguments from a @c packed_iarchive
+ * themselves. The typed ones, registered by their type, are function
+ * objects called as <tt>h(source, args...)</tt>, and are given ids in
+ * the order of registration: all the processes must register the same
+ * handlers in the same order. Typed handlers need C++11.
+ *
+ * All the messages travel on the tag given at construction, which no
+ * other message on the communicator should use.
+ */
+class BOOST_MPI_DECL active_messages
+{
+public:
+  /**
+   * The type of the low-level handlers, called with the source of the
+   * message and the archive to read its arguments from.
+   */
+  typedef function<void (int source, packed_iarchive& ar)> handler;
+
+  /**
+   * Build an object sending batches of up to @p max_bytes bytes on @p
+   * tag of @p comm. With a @p max_bytes of 0, each message is sent as
+   * soon as it is posted.
+   */
+  active_messages(const communicator& comm, int tag = 0,
+                  std::size_t max_bytes = 65536)
+    : m_comm(comm), m_tag(tag), m_max_bytes(max_bytes), m_batches(comm.size()),
+      m_posted(0), m_handled(0) {}
+
+  /**
+   * Wait for the batches in flight. Messages that have not been
+   * flushed are not sent.
+   */
+  ~active_messages();
+
+  /**
+   * Register the low-level handler @p h under @p id, in place of the
+   * one registered before, if any.
+   */
+  void register_handler(int id, const handler& h) { m_handlers[id] = h; }
+
+  /**
+   * Post a message with no arguments to the handler @p id of @p dest.
+   */
+  void post(int dest, int id) { start(dest, id); finish(dest); }
+
+  /**
+   * Post a message to the handler @p id of @p dest, which reads @p
+   * value from its archive.
+   */
+  template<typename T>
+  void post(int dest, int id, const T& value)
+  {
+    start(dest, id) << value;
+    finish(dest);
+  }
+
+#if defined(BOOST_MPI_HAS_TYPED_ACTIVE_MESSAGES)
+  /**
+   * Register the typed handler @p h, a function object called as
+   * <tt>h(source, args...)</tt> with the arguments posted to it.
+   *
+   *   @returns The id of the handler.
+   */
+  template<typename Handler>
+  int register_handler(const Handler& h)
+  {
+    int id = m_handlers.empty() ? 0 : m_handlers.rbegin()->first + 1;
+    m_handlers[id] = detail::typed_am_handler<Handler>(h);
+    m_types[&typeid(Handler)] = id;
+    return id;
+  }
+
+  /**
+   * Post a message to the handler of type @c Handler of @p dest, with
+   * @p args converted to the arguments the handler takes.
+   */
+  template<typename Handler, typename... Args>
+  void post(int dest, Args&&... args)
+  {
+    typedef typename detail::am_arguments<Handler>::arguments arguments;
+    static_assert(std::tuple_size<arguments>::value == sizeof...(Args),
+                  "the handler takes another number of arguments");
+    detail::pack_am_arguments<arguments>
+      (start(dest, handler_id(typeid(Handler))),
+       typename detail::make_am_indices<sizeof...(Args)>::type(),
+       std::forward<Args>(args)...);
+    finish(dest);
+  }
+#endif
+
+  /**
+   * Send the messages posted to @p dest, if any.
+   */
+  void flush(int dest);
+
+  /**
+   * Send the messages posted to all destinations.
+   */
+  void flush();
+
+  /**
+   * Flush, then run the handlers of the messages that have arrived.
+   * The messages that these handlers post are sent by the next call.
+   *
+   *   @returns The number of handlers run.
+   */
+  std::size_t progress();
+
+  /**
+   * Wait until all the batches sent have completed.
+   */
+  void wait();
+
+  /**
+   * The number of messages posted, including those not yet sent.
+   */
+  unsigned long posted() const { return m_posted; }
+
+  /**
+   * The number of handlers run by @c progress.
+   */
+  unsigned long handled() const { return m_handled; }
+
+  /**
+   * The number of batches sent and not yet completed.
+   */
+  std::size_t in_flight() const { return m_sends.size(); }
+
+  /**
+   * The communicator of the object.
+   */
+  const communicator& comm() const { return m_comm; }
+
+private:
+  // Pack the id of a message, and return the archive to pack its
+  // arguments into.
+  packed_oarchive& start(int dest, int id)
+  {
+    packed_oarchive& ar = m_batches[dest].add(m_comm);
+    ar << id;
+    return ar;
+  }
+
+  // Count the message, and send its batch if it is full.
+  void finish(int dest)
+  {
+    ++m_posted;
+    if (m_batches[dest].bytes() >= m_max_bytes) {
+      flush(dest);
+    }
+  }
+
+  int handler_id(const std::type_info& type) const;
+
+  // Run the handlers of a batch that has arrived.
+  std::size_t dispatch(int source, packed_iarchive& ar);
+
+  // Forget the sends that have completed.
+  void reap();
+
+  typedef std::map<const std::type_info*, int, detail::type_info_compare> type_map;
+
+  communicator                   m_comm;
+  int                            m_tag;
+  std::size_t                    m_max_bytes;
+  std::vector<detail::packed_batch> m_batches;
+  std::map<int, handler>         m_handlers;
+  type_map                       m_types;
+  std::vector<request>           m_sends;
+  unsigned long                  m_posted;
+  unsigned long                  m_handled;
+};
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_ACTIVE_MESSAGES_HPP
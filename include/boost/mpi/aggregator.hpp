@@ -0,0 +1,273 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file aggregator.hpp
+ *
+ *  This header defines the @c aggregator class template, which gathers
+ *  small messages to the same destination into larger ones.
+ */
+#ifndef BOOST_MPI_AGGREGATOR_HPP
+#define BOOST_MPI_AGGREGATOR_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/status.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/mpi/detail/packed_batch.hpp>
+#include <boost/assert.hpp>
+#include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  /**
+   * The values waiting to be sent to one destination, in their own
+   * array when they have an MPI datatype...
+   */
+  template<typename T, bool Plain = is_mpi_datatype<T>::value>
+  class aggregation_outbox
+  {
+  public:
+    aggregation_outbox() {}
+
+    void add(const communicator&, const T& value) { m_values.push_back(value); }
+
+    int count() const { return int(m_values.size()); }
+
+    std::size_t bytes() const { return m_values.size() * sizeof(T); }
+
+    request post(const communicator& comm, int dest, int tag)
+    {
+      shared_ptr<std::vector<T> > values(new std::vector<T>());
+      values->swap(m_values);
+      request r = comm.isend(dest, tag, c_data(*values), int(values->size()));
+      r.preserve(values);
+      return r;
+    }
+
+    template<typename Handler>
+    static int deliver(const communicator& comm, const status& stat, Handler& handler)
+    {
+      optional<int> n = stat.template count<T>();
+      BOOST_ASSERT(n);
+      std::vector<T> values(*n);
+      comm.recv(stat.source(), stat.tag(), c_data(values), *n);
+      for (int i = 0; i < *n; ++i) {
+        handler(stat.source(), values[i]);
+      }
+      return *n;
+    }
+
+  private:
+    std::vector<T> m_values;
+  };
+
+  /**
+   * ...and packed one after the other, behind their number, otherwise.
+   */
+  template<typename T>
+  class aggregation_outbox<T, false>
+  {
+  public:
+    void add(const communicator& comm, const T& value) { m_batch.add(comm) << value; }
+
+    int count() const { return m_batch.count(); }
+
+    std::size_t bytes() const { return m_batch.bytes(); }
+
+    request post(const communicator& comm, int dest, int tag)
+    {
+      return m_batch.post(comm, dest, tag);
+    }
+
+    template<typename Handler>
+    static int deliver(const communicator& comm, const status& stat, Handler& handler)
+    {
+      packed_iarchive ia(comm);
+      comm.recv(stat.source(), stat.tag(), ia);
+      int n;
+      ia >> n;
+      for (int i = 0; i < n; ++i) {
+        T value;
+        ia >> value;
+        handler(stat.source(), value);
+      }
+      return n;
+    }
+
+  private:
+    packed_batch m_batch;
+  };
+} // end namespace detail
+
+/**
+ * @brief Gathers small messages to the same destination into batches.
+ *
+ * Sending many small messages costs an MPI call, and a message
+ * header on the network, each. An @c aggregator instead appends each
+ * value to a buffer of its destination, which costs a copy (or a
+ * serialization, for types without an MPI datatype), and sends the
+ * buffer as one message when it holds @c max_bytes bytes or @c
+ * max_count values, or when the program calls @c flush. The batches
+ * are sent with non-blocking sends, which the aggregator completes as
+ * it goes.
+ *
+ * The receiving side calls @c poll, which receives the batches that
+ * have arrived and passes each value, with its source, to a handler.
+ * The values from one source arrive in the order they were sent.
+ *
+ * All the batches travel on the tag given at construction, which no
+ * other message on the communicator should use. Values still in the
+ * buffers are only sent by a flush: the program should flush before
+ * destroying an aggregator, and usually before waiting for the values
+ * sent to it.
+ */
+template<typename T>
+class aggregator
+{
+public:
+  /**
+   * Build an aggregator sending batches of up to @p max_bytes bytes
+   * and @p max_count values on @p tag of @p comm.
+   */
+  aggregator(const communicator& comm, int tag,
+             std::size_t max_bytes = 65536, int max_count = 4096)
+    : m_comm(comm), m_tag(tag), m_max_bytes(max_bytes), m_max_count(max_count),
+      m_outboxes(comm.size()), m_sent(0), m_received(0) {}
+
+  /**
+   * Wait for the batches in flight.
+   */
+  ~aggregator() { wait(); }
+
+  /**
+   * Add @p value to the buffer of @p dest, and send the buffer if it
+   * is full.
+   */
+  void send(int dest, const T& value)
+  {
+    outbox& o = m_outboxes[dest];
+    o.add(m_comm, value);
+    ++m_sent;
+    if (o.count() >= m_max_count || o.bytes() >= m_max_bytes) {
+      post(dest);
+    }
+  }
+
+  /**
+   * Send the buffer of @p dest, if it holds values.
+   */
+  void flush(int dest)
+  {
+    if (m_outboxes[dest].count() > 0) {
+      post(dest);
+    }
+  }
+
+  /**
+   * Send all the buffers that hold values.
+   */
+  void flush()
+  {
+    for (int dest = 0; dest < int(m_outboxes.size()); ++dest) {
+      flush(dest);
+    }
+  }
+
+  /**
+   * Receive the batches that have arrived, and call @p handler(source,
+   * value) for each of their values, in order. Also complete the
+   * batches sent that have been.
+   *
+   *   @returns The number of values passed to @p handler.
+   */
+  template<typename Handler>
+  std::size_t poll(Handler handler)
+  {
+    reap();
+    std::size_t delivered = 0;
+    while (optional<status> stat = m_comm.iprobe(any_source, m_tag)) {
+      delivered += outbox::deliver(m_comm, *stat, handler);
+    }
+    m_received += delivered;
+    return delivered;
+  }
+
+  /**
+   * Wait until all the batches sent have completed, and their buffers
+   * can be reused.
+   */
+  void wait()
+  {
+    for (std::size_t i = 0; i < m_sends.size(); ++i) {
+      m_sends[i].wait();
+    }
+    m_sends.clear();
+  }
+
+  /**
+   * The number of values sent, including those still in the buffers.
+   */
+  unsigned long sent() const { return m_sent; }
+
+  /**
+   * The number of values passed to the handlers of @c poll.
+   */
+  unsigned long received() const { return m_received; }
+
+  /**
+   * The number of batches sent and not yet completed.
+   */
+  std::size_t in_flight() const { return m_sends.size(); }
+
+  /**
+   * The communicator of the aggregator.
+   */
+  const communicator& comm() const { return m_comm; }
+
+private:
+  typedef detail::aggregation_outbox<T> outbox;
+
+  void post(int dest)
+  {
+    m_sends.push_back(m_outboxes[dest].post(m_comm, dest, m_tag));
+  }
+
+  // Forget the sends that have completed.
+  void reap()
+  {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_sends.size(); ++i) {
+      if (!m_sends[i].test()) {
+        if (kept != i) {
+          m_sends[kept] = m_sends[i];
+        }
+        ++kept;
+      }
+    }
+    m_sends.resize(kept);
+  }
+
+  communicator         m_comm;
+  int                  m_tag;
+  std::size_t          m_max_bytes;
+  int                  m_max_count;
+  std::vector<outbox>  m_outboxes;
+  std::vector<request> m_sends;
+  unsigned long        m_sent;
+  unsigned long        m_received;
+};
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_AGGREGATOR_HPP
@@ -0,0 +1,329 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file asio.hpp
+ *
+ *  This header turns non-blocking communications into asynchronous
+ *  operations of Boost.Asio, that complete through an @c io_context
+ *  and accept any completion token. It requires C++11 and
+ *  Boost.Asio, and is not included by <tt>boost/mpi.hpp</tt>.
+ */
+#ifndef BOOST_MPI_ASIO_HPP
+#define BOOST_MPI_ASIO_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/status.hpp>
+#include <boost/mpi/detail/test_batch.hpp>
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/system/error_code.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  // The handler of an asynchronous operation, whatever its type.
+  class asio_completion
+  {
+  public:
+    virtual ~asio_completion() {}
+    // Have the handler called with s, on its executor.
+    virtual void complete(const status& s) = 0;
+  };
+
+  // Call a handler with the result of an operation.
+  template<typename Handler>
+  struct asio_binder
+  {
+    asio_binder(Handler&& h, const status& s) : m_handler(std::move(h)), m_status(s) {}
+    void operator()() { m_handler(boost::system::error_code(), m_status); }
+
+    Handler m_handler;
+    status  m_status;
+  };
+
+  template<typename Handler>
+  class asio_completion_impl : public asio_completion
+  {
+  public:
+    typedef typename boost::asio::associated_executor<
+      Handler, boost::asio::io_context::executor_type>::type executor_type;
+
+    asio_completion_impl(Handler&& h, boost::asio::io_context& ioc)
+      : m_work(boost::asio::get_associated_executor(h, ioc.get_executor())),
+        m_handler(std::move(h)) {}
+
+    void complete(const status& s)
+    {
+      executor_type ex = m_work.get_executor();
+      boost::asio::post(ex, asio_binder<Handler>(std::move(m_handler), s));
+      m_work.reset();
+    }
+
+  private:
+    // Keep the executor of the handler busy until it is called.
+    boost::asio::executor_work_guard<executor_type> m_work;
+    Handler                                        m_handler;
+  };
+
+  // The identifier of a service, defined in a header.
+  template<typename Service>
+  struct asio_service_id
+  {
+    static boost::asio::io_context::id id;
+  };
+
+  template<typename Service>
+  boost::asio::io_context::id asio_service_id<Service>::id;
+} // end namespace detail
+
+/**
+ * @brief The service of an @c io_context that completes the
+ * asynchronous operations on requests.
+ *
+ * The service keeps the requests of the pending operations of its @c
+ * io_context, and tests them all at once from a handler it posts to
+ * that @c io_context: the plain MPI requests with a single @c
+ * MPI_Testsome, the others, such as receives of serialized data, with
+ * their own @c test(). The handlers of the operations that have
+ * completed are then posted to their executors.
+ *
+ * The service polls again right away as long as some requests
+ * complete, and for a number of idle polls after that. It then backs
+ * off, polling from a timer whose delay doubles up to a maximum, so
+ * that an @c io_context waiting mostly for MPI does not spin. The
+ * service only polls while some operations are pending.
+ *
+ * When several threads run the @c io_context, the polls are
+ * serialized, but they may happen in any of these threads, which
+ * then requires @c threading::serialized at least.
+ */
+class request_service : public boost::asio::io_context::service,
+                        public detail::asio_service_id<request_service>
+{
+public:
+
+  explicit request_service(boost::asio::io_context& ioc)
+    : boost::asio::io_context::service(ioc),
+      m_context(ioc), m_timer(ioc), m_scheduled(false), m_idle_polls(0),
+      m_spin_polls(64), m_max_delay(1000) {}
+
+  /**
+   * Set how the polls back off when no request completes: after @p
+   * spin_polls immediate polls, the delay between polls starts at one
+   * microsecond and doubles up to @p max_delay.
+   */
+  void set_backoff(unsigned spin_polls, std::chrono::microseconds max_delay)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_spin_polls = spin_polls;
+    m_max_delay  = max_delay;
+  }
+
+  /**
+   * The number of operations that have not completed.
+   */
+  std::size_t pending() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+  }
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Call @p c when @p r has completed.
+   */
+  void add(const request& r, detail::asio_completion* c)
+  {
+    shared_ptr<detail::asio_completion> completion(c);
+    if (!r.active()) {
+      completion->complete(status());
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    entry e = { r, completion };
+    m_entries.push_back(e);
+    if (!m_scheduled) {
+      schedule(true);
+    }
+  }
+
+private:
+  struct entry
+  {
+    request                             m_request;
+    shared_ptr<detail::asio_completion> m_completion;
+  };
+
+  struct poller
+  {
+    explicit poller(request_service* s) : m_service(s) {}
+    void operator()() const { m_service->poll(); }
+    void operator()(const boost::system::error_code& ec) const
+    {
+      if (!ec) {
+        m_service->poll();
+      }
+    }
+    request_service* m_service;
+  };
+
+  void shutdown()
+  {
+    // The handlers are destroyed without being called.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+  }
+
+  // Poll again, right away or after a delay; m_mutex is locked.
+  void schedule(bool progressed)
+  {
+    m_scheduled = true;
+    m_idle_polls = progressed ? 0 : m_idle_polls + 1;
+    if (m_idle_polls <= m_spin_polls) {
+      boost::asio::post(m_context, poller(this));
+    } else {
+      unsigned shift = std::min(m_idle_polls - m_spin_polls - 1, 20u);
+      std::chrono::microseconds delay(std::min<std::chrono::microseconds::rep>(
+        std::chrono::microseconds::rep(1) << shift, m_max_delay.count()));
+      m_timer.expires_after(delay);
+      m_timer.async_wait(poller(this));
+    }
+  }
+
+  void poll()
+  {
+    std::vector<std::pair<shared_ptr<detail::asio_completion>, status> > ready;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_scheduled = false;
+      if (m_entries.empty()) {
+        return;
+      }
+      std::vector<request*> requests(m_entries.size());
+      for (std::size_t i = 0; i < m_entries.size(); ++i) {
+        requests[i] = &m_entries[i].m_request;
+      }
+      std::vector<std::pair<int, status> > completed;
+      try {
+        detail::test_batch(&requests[0], int(requests.size()), completed);
+      } catch (...) {
+        schedule(false);
+        throw;
+      }
+      if (!completed.empty()) {
+        std::vector<bool> done(m_entries.size(), false);
+        for (std::size_t k = 0; k < completed.size(); ++k) {
+          done[completed[k].first] = true;
+          ready.push_back(std::make_pair(m_entries[completed[k].first].m_completion,
+                                         completed[k].second));
+        }
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < m_entries.size(); ++i) {
+          if (!done[i]) {
+            m_entries[kept++] = m_entries[i];
+          }
+        }
+        m_entries.resize(kept);
+      }
+      if (!m_entries.empty()) {
+        schedule(!ready.empty());
+      }
+    }
+    for (std::size_t k = 0; k < ready.size(); ++k) {
+      ready[k].first->complete(ready[k].second);
+    }
+  }
+
+  boost::asio::io_context&  m_context;
+  boost::asio::steady_timer m_timer;
+  mutable std::mutex        m_mutex;
+  std::vector<entry>        m_entries;
+  bool                      m_scheduled;
+  unsigned                  m_idle_polls;
+  unsigned                  m_spin_polls;
+  std::chrono::microseconds m_max_delay;
+};
+
+namespace detail {
+  // Start the wait for a request, once the completion token has
+  // given the actual handler.
+  struct initiate_async_wait
+  {
+    template<typename Handler>
+    void operator()(Handler&& handler, boost::asio::io_context* ioc, const request& r) const
+    {
+      typedef typename std::decay<Handler>::type handler_type;
+      handler_type h(std::forward<Handler>(handler));
+      boost::asio::use_service<request_service>(*ioc)
+        .add(r, new asio_completion_impl<handler_type>(std::move(h), *ioc));
+    }
+  };
+} // end namespace detail
+
+/**
+ * Wait asynchronously for @p r to complete, through @p ioc.
+ *
+ *   @param token The completion token, such as a handler of signature
+ *   <tt>void(boost::system::error_code, status)</tt>, @c
+ *   boost::asio::use_future or @c boost::asio::use_awaitable.
+ *
+ *   @returns What the completion token makes of the operation.
+ */
+template<typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::system::error_code, status))
+async_wait(boost::asio::io_context& ioc, const request& r, CompletionToken&& token)
+{
+  return boost::asio::async_initiate<CompletionToken,
+                                     void(boost::system::error_code, status)>(
+    detail::initiate_async_wait(), token, &ioc, r);
+}
+
+/**
+ * Receive a value from @p source asynchronously, through @p ioc. The
+ * value is received in place, and must remain until the operation
+ * completes.
+ */
+template<typename T, typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::system::error_code, status))
+async_recv(boost::asio::io_context& ioc, const communicator& comm, int source, int tag,
+           T& value, CompletionToken&& token)
+{
+  return ::boost::mpi::async_wait(ioc, comm.irecv(source, tag, value),
+                                  std::forward<CompletionToken>(token));
+}
+
+/**
+ * Send a copy of @p value to @p dest asynchronously, through @p ioc.
+ */
+template<typename T, typename CompletionToken>
+BOOST_ASIO_INITFN_RESULT_TYPE(CompletionToken, void(boost::system::error_code, status))
+async_send(boost::asio::io_context& ioc, const communicator& comm, int dest, int tag,
+           const T& value, CompletionToken&& token)
+{
+  shared_ptr<T> copy(new T(value));
+  request r = comm.isend(dest, tag, *copy);
+  r.preserve(copy);
+  return ::boost::mpi::async_wait(ioc, r, std::forward<CompletionToken>(token));
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_ASIO_HPP
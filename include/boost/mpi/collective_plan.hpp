@@ -0,0 +1,126 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file collective_plan.hpp
+ *
+ *  This header defines the @c collective_plan class, which lets
+ *  repeated serialized gathers and scatters skip the exchange of the
+ *  archive sizes.
+ */
+#ifndef BOOST_MPI_COLLECTIVE_PLAN_HPP
+#define BOOST_MPI_COLLECTIVE_PLAN_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/allocator.hpp>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+/**
+ * @brief The sizes recorded by a serialized collective, for reuse by
+ * the next calls of the same collective.
+ *
+ * The collectives that serialize their values (@c gather, @c gatherv,
+ * @c all_gather, @c scatter and @c scatterv) exchange the sizes of
+ * the archives before the archives themselves, which doubles their
+ * latency. Iterative codes often call them with archives of the same
+ * sizes at each iteration.
+ *
+ * Given a @c collective_plan, these collectives record the size of
+ * the archive of each process. Each later call sends every archive in
+ * a slot of the recorded size, prefixed with its actual size: when no
+ * archive has grown, which every receiver sees from the prefixes,
+ * the collective takes a single round. The archives that have grown
+ * are completed in a second round, and their new sizes are recorded.
+ *
+ * A plan is bound to a communicator, and to one collective and root
+ * at a time: using it for another collective, or with another root,
+ * starts over. All the processes must use their plans in the same
+ * way. Collectives on types with an associated MPI datatype ignore
+ * the plan.
+ */
+class BOOST_MPI_DECL collective_plan
+{
+public:
+  /**
+   * Build an empty plan for the collectives over @p comm. This is a
+   * local operation.
+   */
+  explicit collective_plan(const communicator& comm);
+
+  /**
+   * The communicator of the collectives.
+   */
+  const communicator& comm() const { return m_comm; }
+
+  /**
+   * Forget the recorded sizes, so that the next collective exchanges
+   * them again. The slots only grow otherwise. All the processes must
+   * reset their plans together.
+   */
+  void reset();
+
+  /**
+   * Determine whether the last collective made with this plan took a
+   * single round, as far as the calling process knows: on the
+   * receiving processes of a gather or scatter, whether their own
+   * archive fit in its slot.
+   */
+  bool single_round() const { return m_single_round; }
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Gather the @p size bytes at @p data of every process to every
+   * process. The bytes of process @c p are stored at @c
+   * buffer[offsets[p]] and are @c sizes[p] long.
+   */
+  void all_gather(const void* data, int size,
+                  std::vector<char, allocator<char> >& buffer,
+                  std::vector<int>& sizes, std::vector<int>& offsets);
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Same as @c all_gather, with the result on @p root only.
+   */
+  void gather(int root, const void* data, int size,
+              std::vector<char, allocator<char> >& buffer,
+              std::vector<int>& sizes, std::vector<int>& offsets);
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Send to each process @c p the @c sizes[p] bytes of @p data (on
+   * @p root) that follow those of process @c p-1, into @p received.
+   */
+  void scatter(int root, const std::vector<char, allocator<char> >& data,
+               const std::vector<int>& sizes,
+               std::vector<char, allocator<char> >& received);
+
+private:
+  /// Start over if the plan was made for another collective or root.
+  void prepare(int kind, int root);
+
+  /// Make the slot of process p large enough for size bytes.
+  void grow(int p, int size);
+
+  /// Compute the place of each slot from their sizes.
+  void update_offsets();
+
+  communicator     m_comm;
+  int              m_kind;
+  int              m_root;
+  /// The size of the slot of each process, including the size prefix.
+  std::vector<int> m_slots;
+  std::vector<int> m_slot_offsets;
+  bool             m_single_round;
+};
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_COLLECTIVE_PLAN_HPP
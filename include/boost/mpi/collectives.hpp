@@ -19,10 +19,15 @@
 #define BOOST_MPI_COLLECTIVES_HPP
 
 #include <boost/mpi/communicator.hpp>
+#include <boost/mpi/collective_plan.hpp>
 #include <boost/mpi/inplace.hpp>
+#include <cstddef>
+#include <map>
 #include <vector>
 
 namespace boost { namespace mpi {
+
+class content;
 /**
  *  @brief Gather the values stored at every process into vectors of
  *  values from each process.
@@ -74,6 +79,16 @@ template<typename T>
 void
 all_gather(const communicator& comm, const T* in_values, int n, T* out_values);
 
+/**
+ * Gather serialized values with the archive sizes recorded by @p
+ * plan: when no archive has grown since the previous call with the
+ * same plan, the sizes and archives travel in a single @c
+ * MPI_Allgatherv. See @c collective_plan.
+ */
+template<typename T>
+void
+all_gather(collective_plan& plan, const T& in_value, std::vector<T>& out_values);
+
 /**
  * \overload
  */
@@ -252,6 +267,98 @@ template<typename T>
 void 
 all_to_all(const communicator& comm, const T* in_values, int n, T* out_values);
 
+/**
+ *  @brief Send a different number of values from every process to
+ *  every other process.
+ *
+ *  @c all_to_allv is a variant of @c all_to_all in which each
+ *  process sends @c in_sizes[j] values to process @c j, and receives
+ *  @c out_sizes[i] values from process @c i. The type @c T of the
+ *  values may be any type that is serializable or has an associated
+ *  MPI data type.
+ *
+ *  When the type @c T has an associated MPI data type, this routine
+ *  invokes @c MPI_Alltoallv to exchange the values. Otherwise, the
+ *  values sent to each process are serialized in one archive per
+ *  destination, and the archives are exchanged with @c
+ *  MPI_Alltoallv.
+ *
+ *    @param comm The communicator over which the all-to-all
+ *    communication will occur.
+ *
+ *    @param in_values The values to send, those for process @c j
+ *    starting at @c in_displs[j], or following those for process @c
+ *    j-1 if no displacements are given.
+ *
+ *    @param in_sizes The number of values to send to each process.
+ *
+ *    @param out_values The storage for the values received, those of
+ *    process @c i starting at @c out_displs[i], or following those of
+ *    process @c i-1 if no displacements are given. In the vector
+ *    form, it is resized to hold all of them.
+ *
+ *    @param out_sizes The number of values to receive from each
+ *    process. In the vector form, it does not need to be known in
+ *    advance: it is filled by @c all_to_allv.
+ */
+template<typename T>
+void
+all_to_allv(const communicator& comm,
+            const std::vector<T>& in_values, const std::vector<int>& in_sizes,
+            std::vector<T>& out_values, std::vector<int>& out_sizes);
+
+/**
+ * \overload
+ */
+template<typename T>
+void
+all_to_allv(const communicator& comm,
+            const T* in_values, const std::vector<int>& in_sizes,
+            T* out_values, const std::vector<int>& out_sizes);
+
+/**
+ * \overload
+ */
+template<typename T>
+void
+all_to_allv(const communicator& comm,
+            const T* in_values, const std::vector<int>& in_sizes,
+            const std::vector<int>& in_displs,
+            T* out_values, const std::vector<int>& out_sizes,
+            const std::vector<int>& out_displs);
+
+/**
+ *  @brief Send data of different MPI data types from every process
+ *  to every other process.
+ *
+ *  @c all_to_allw invokes @c MPI_Alltoallw: process @c i sends @c
+ *  in_sizes[j] elements of type @c in_types[j], at @c in_displs[j]
+ *  bytes from @p in_buffer, to process @c j, which receives them as @c
+ *  out_sizes[i] elements of type @c out_types[i] at @c out_displs[i]
+ *  bytes from @p out_buffer. Derived data types let each process
+ *  send and receive non-contiguous data without packing it first.
+ */
+BOOST_MPI_DECL void
+all_to_allw(const communicator& comm,
+            const void* in_buffer, const std::vector<int>& in_sizes,
+            const std::vector<int>& in_displs, const std::vector<MPI_Datatype>& in_types,
+            void* out_buffer, const std::vector<int>& out_sizes,
+            const std::vector<int>& out_displs, const std::vector<MPI_Datatype>& out_types);
+
+/**
+ *  @brief Send the content of a different object from every process
+ *  to every other process.
+ *
+ *  The content of @c in_values[j] (see @c get_content) is sent to
+ *  process @c j, and the content of @c out_values[i] is received
+ *  from process @c i, with a single @c MPI_Alltoallw and without any
+ *  packing. The objects must have been given their structure
+ *  beforehand, e.g. with the skeleton of their sender.
+ */
+BOOST_MPI_DECL void
+all_to_allw(const communicator& comm, const std::vector<content>& in_values,
+            const std::vector<content>& out_values);
+
 /**
  * @brief Broadcast a value from a root process to all other
  * processes.
@@ -299,6 +406,19 @@ void broadcast(const communicator& comm, T& value, int root);
 template<typename T>
 void broadcast(const communicator& comm, T* values, int n, int root);
 
+/**
+ * Broadcast a serialized value whose archive is expected to be at
+ * most @p size_hint bytes long. The size of the archive and the
+ * archive are then sent in a single @c MPI_Bcast of @p size_hint
+ * bytes plus the size; a larger archive takes a second @c MPI_Bcast
+ * of the rest. Without a hint, the size is broadcast first, unless
+ * @c communicator::enable_speculative_collectives has set a slot size
+ * for @p comm. The hint must be the same on all processes; it is
+ * ignored for types with an associated MPI data type.
+ */
+template<typename T>
+void broadcast(const communicator& comm, T& value, int root, std::size_t size_hint);
+
 /**
  * \overload
  */
@@ -380,6 +500,16 @@ gather(const communicator& comm, const T* in_values, int n, T* out_values,
 template<typename T>
 void gather(const communicator& comm, const T* in_values, int n, int root);
 
+/**
+ * Gather serialized values with the archive sizes recorded by @p
+ * plan: when no archive has grown since the previous call with the
+ * same plan and root, the sizes and archives travel in a single @c
+ * MPI_Gatherv. See @c collective_plan.
+ */
+template<typename T>
+void
+gather(collective_plan& plan, const T& in_value, std::vector<T>& out_values, int root);
+
 /**
  *  @brief Similar to boost::mpi::gather with the difference that the number
  *  of values to be send by non-root processes can vary.
@@ -449,6 +579,65 @@ void
 gatherv(const communicator& comm, const std::vector<T>& in_values,
         T* out_values, const std::vector<int>& sizes, int root);
 
+/**
+ * Gather serialized values with the archive sizes recorded by @p
+ * plan. See @c collective_plan.
+ */
+template<typename T>
+void
+gatherv(collective_plan& plan, const std::vector<T>& in_values,
+        T* out_values, const std::vector<int>& sizes, int root);
+
+/**
+ *  @brief Gather the values stored at every process to the root,
+ *  handing each one to a function as soon as it has arrived.
+ *
+ *  @c streaming_gather is a variant of @c gather for values too large
+ *  to be all held at the root at once. Instead of storing the
+ *  values in a vector, the root calls @c consume(source, value) for
+ *  each of them, with @c value a <tt>const T&</tt> that is only valid
+ *  during the call. The value of the root is handed first; the others
+ *  come in the order their transfers complete, which may differ from
+ *  the rank order.
+ *
+ *  The root receives from at most @p window processes at a time,
+ *  with one non-blocking receive (and one value) each, so its memory
+ *  use does not depend on the number of processes; while the
+ *  consumer handles a value, the transfers of the others go on. The
+ *  other processes send their value with a blocking @c send.
+ *
+ *    @param comm The communicator over which the gather will occur.
+ *
+ *    @param in_value The value to be transmitted by each process.
+ *
+ *    @param consume A function object called at the root as @c
+ *    consume(source, value) for each process.
+ *
+ *    @param root The process ID number that will receive the values.
+ *    This value must be the same on all processes.
+ *
+ *    @param window The maximum number of values received at once at
+ *    the root; 16 by default.
+ */
+template<typename T, typename Consumer>
+void
+streaming_gather(const communicator& comm, const T& in_value, Consumer consume,
+                 int root, int window);
+
+/**
+ * \overload
+ */
+template<typename T, typename Consumer>
+void
+streaming_gather(const communicator& comm, const T& in_value, Consumer consume,
+                 int root);
+
+/**
+ * \overload
+ */
+template<typename T>
+void streaming_gather(const communicator& comm, const T& in_value, int root);
+
 /**
  *  @brief Scatter the values stored at the root to all processes
  *  within the communicator.
@@ -518,6 +707,17 @@ scatter(const communicator& comm, const T* in_values, T* out_values, int n,
 template<typename T>
 void scatter(const communicator& comm, T* out_values, int n, int root);
 
+/**
+ * Scatter serialized values with the archive sizes recorded by @p
+ * plan: when no archive has grown since the previous call with the
+ * same plan and root, the sizes and archives travel in a single @c
+ * MPI_Scatterv. See @c collective_plan.
+ */
+template<typename T>
+void
+scatter(collective_plan& plan, const std::vector<T>& in_values, T& out_value,
+        int root);
+
 /**
  *  @brief Similar to boost::mpi::scatter with the difference that the number
  *  of values stored at the root process does not need to be a multiple of
@@ -583,6 +783,66 @@ void
 scatterv(const communicator& comm, const std::vector<T>& in_values,
          const std::vector<int>& sizes, T* out_values, int root);
 
+/**
+ * Scatter serialized values with the archive sizes recorded by @p
+ * plan. See @c collective_plan. As with the other overloads, @p
+ * in_values and @p sizes are only used at the root, and @p out_size
+ * is the number of values received by the calling process.
+ */
+template<typename T>
+void
+scatterv(collective_plan& plan, const std::vector<T>& in_values,
+         const std::vector<int>& sizes, T* out_values, int out_size, int root);
+
+/**
+ *  @brief Scatter values that the root generates one destination at
+ *  a time.
+ *
+ *  @c streaming_scatter is a variant of @c scatter for values too
+ *  large to be all held at the root at once. Instead of taking them
+ *  from a vector, the root calls @c generate(dest) for each process,
+ *  in rank order, and sends the value it returns, serialized in an
+ *  archive of its own, with a non-blocking send.
+ *
+ *  The root sends to at most @p window processes at a time, and only
+ *  generates the value of the next process when one of these sends
+ *  has completed, so its memory use does not depend on the number of
+ *  processes; the value of a process is generated while those of the
+ *  previous ones are in transit. The other processes receive their
+ *  value with a blocking @c recv.
+ *
+ *    @param comm The communicator over which the scatter will occur.
+ *
+ *    @param generate A function object called at the root as @c
+ *    generate(dest), which returns the value for process @c dest.
+ *
+ *    @param out_value The value received by this process.
+ *
+ *    @param root The process ID number that will generate the
+ *    values. This value must be the same on all processes.
+ *
+ *    @param window The maximum number of values in transit at once;
+ *    16 by default.
+ */
+template<typename T, typename Generator>
+void
+streaming_scatter(const communicator& comm, Generator generate, T& out_value,
+                  int root, int window);
+
+/**
+ * \overload
+ */
+template<typename T, typename Generator>
+void
+streaming_scatter(const communicator& comm, Generator generate, T& out_value,
+                  int root);
+
+/**
+ * \overload
+ */
+template<typename T>
+void streaming_scatter(const communicator& comm, T& out_value, int root);
+
 /**
  *  @brief Combine the values stored by each process into a single
  *  value at the root.
@@ -660,6 +920,82 @@ template<typename T, typename Op>
 void 
 reduce(const communicator& comm, const T* in_values, int n, Op op, int root);
 
+/**
+ *  @brief Combine the values stored by each process and scatter the
+ *  result, each process receiving its own block of it.
+ *
+ *  @c reduce_scatter combines element-wise the arrays stored by each
+ *  process, like @c all_reduce, but process @c i only receives the @c
+ *  sizes[i] elements of the result that follow those of process @c
+ *  i-1. It is equivalent to an @c all_reduce followed by each
+ *  process keeping its part, without computing or transmitting the
+ *  rest.
+ *
+ *  When the type @c T has an associated MPI data type, this routine
+ *  invokes @c MPI_Reduce_scatter, with a built-in MPI operation if
+ *  possible and a user-defined one otherwise. Other types are
+ *  serialized, and exchanged pairwise: each process sends to each
+ *  other process the block of its values this process is responsible
+ *  for, and combines the blocks it receives in rank order, so that
+ *  non-commutative operations are supported.
+ *
+ *    @param comm The communicator over which the reduction will
+ *    occur.
+ *
+ *    @param in_values The values of the calling process: the sum of
+ *    the @p sizes elements.
+ *
+ *    @param sizes The number of elements of the result each process
+ *    receives; the same on all processes.
+ *
+ *    @param out_values Will receive the @c sizes[comm.rank()]
+ *    elements of the result of the calling process. A vector is
+ *    resized accordingly.
+ *
+ *    @param op The binary operation that combines two values of type
+ *    @c T. See @c all_reduce.
+ */
+template<typename T, typename Op>
+void
+reduce_scatter(const communicator& comm, const T* in_values,
+               const std::vector<int>& sizes, T* out_values, Op op);
+
+/**
+ * \overload
+ */
+template<typename T, typename Op>
+void
+reduce_scatter(const communicator& comm, const std::vector<T>& in_values,
+               const std::vector<int>& sizes, std::vector<T>& out_values, Op op);
+
+/**
+ *  @brief Combine the values stored by each process and scatter the
+ *  result in blocks of the same size.
+ *
+ *  @c reduce_scatter_block is a @c reduce_scatter where each process
+ *  receives @p n elements of the result: process @c i gets the
+ *  elements from @c i*n to @c (i+1)*n. When the type @c T has an
+ *  associated MPI data type, this routine invokes @c
+ *  MPI_Reduce_scatter_block.
+ *
+ *    @param n The number of elements of the result each process
+ *    receives. The vector form computes it from the size of @p
+ *    in_values, which must be a multiple of the size of the
+ *    communicator.
+ */
+template<typename T, typename Op>
+void
+reduce_scatter_block(const communicator& comm, const T* in_values, int n,
+                     T* out_values, Op op);
+
+/**
+ * \overload
+ */
+template<typename T, typename Op>
+void
+reduce_scatter_block(const communicator& comm, const std::vector<T>& in_values,
+                     std::vector<T>& out_values, Op op);
+
 /**
  *  @brief Compute a prefix reduction of values from all processes in
  *  the communicator.
@@ -726,6 +1062,164 @@ template<typename T, typename Op>
 void
 scan(const communicator& comm, const T* in_values, int n, T* out_values, Op op);
 
+#if BOOST_MPI_VERSION >= 3
+/**
+ *  @brief Gather the values stored at every neighbor of the calling
+ *  process in a process topology.
+ *
+ *  @c neighbor_all_gather is a collective algorithm that collects the
+ *  value stored at each process into a vector of values at each of
+ *  that process's outgoing neighbors. Each process receives one value
+ *  from each of its incoming neighbors, in the order given by @c
+ *  dist_graph_communicator::sources() (or by the neighbor order MPI
+ *  defines for cartesian and graph topologies). The communicator must
+ *  carry a process topology; otherwise an @c exception is thrown.
+ *
+ *  When the type @c T has an associated MPI data type, this routine
+ *  invokes @c MPI_Neighbor_allgather. Otherwise the values are
+ *  serialized, the archive sizes are exchanged with @c
+ *  MPI_Neighbor_allgather and the archives with @c
+ *  MPI_Neighbor_allgatherv.
+ *
+ *    @param comm The communicator, with a process topology, over
+ *    which the gather will occur.
+ *
+ *    @param in_value The value to be transmitted to each outgoing
+ *    neighbor. For the array variant, @p in_values points to the @p n
+ *    local values to be transmitted.
+ *
+ *    @param out_values A vector or pointer to storage that will be
+ *    populated with the values from each incoming neighbor. If it is
+ *    a vector, it will be resized to the in-degree times @p n.
+ */
+template<typename T>
+void
+neighbor_all_gather(const communicator& comm, const T& in_value,
+                    std::vector<T>& out_values);
+
+/**
+ * \overload
+ */
+template<typename T>
+void
+neighbor_all_gather(const communicator& comm, const T& in_value, T* out_values);
+
+/**
+ * \overload
+ */
+template<typename T>
+void
+neighbor_all_gather(const communicator& comm, const T* in_values, int n,
+                    std::vector<T>& out_values);
+
+/**
+ * \overload
+ */
+template<typename T>
+void
+neighbor_all_gather(const communicator& comm, const T* in_values, int n,
+                    T* out_values);
+
+/**
+ *  @brief Send distinct data to each outgoing neighbor and receive
+ *  distinct data from each incoming neighbor in a process topology.
+ *
+ *  @c neighbor_all_to_all is the topology-restricted counterpart of
+ *  @c all_to_all: the ith block of @p in_values is sent to the ith
+ *  outgoing neighbor, and the ith block of @p out_values is received
+ *  from the ith incoming neighbor. The communicator must carry a
+ *  process topology; otherwise an @c exception is thrown.
+ *
+ *  When the type @c T has an associated MPI data type, this routine
+ *  invokes @c MPI_Neighbor_alltoall. Otherwise the values are
+ *  serialized, one archive per outgoing neighbor, and exchanged with
+ *  @c MPI_Neighbor_alltoall and @c MPI_Neighbor_alltoallv.
+ *
+ *    @param comm The communicator, with a process topology, over
+ *    which the exchange will occur.
+ *
+ *    @param in_values A vector or pointer to storage holding the
+ *    out-degree times @p n values to send.
+ *
+ *    @param n The number of values sent to, and received from, each
+ *    neighbor.
+ *
+ *    @param out_values A vector or pointer to storage that will be
+ *    populated with the in-degree times @p n received values. If it is
+ *    a vector, it will be resized accordingly.
+ */
+template<typename T>
+void
+neighbor_all_to_all(const communicator& comm, const std::vector<T>& in_values,
+                    std::vector<T>& out_values);
+
+/**
+ * \overload
+ */
+template<typename T>
+void
+neighbor_all_to_all(const communicator& comm, const T* in_values, T* out_values);
+
+/**
+ * \overload
+ */
+template<typename T>
+void
+neighbor_all_to_all(const communicator& comm, const std::vector<T>& in_values,
+                    int n, std::vector<T>& out_values);
+
+/**
+ * \overload
+ */
+template<typename T>
+void
+neighbor_all_to_all(const communicator& comm, const T* in_values, int n,
+                    T* out_values);
+
+/**
+ *  @brief Exchange data between processes that each know only their
+ *  own destinations.
+ *
+ *  @c sparse_all_to_all sends @c in_values[j] to each process @c j
+ *  that has an entry in @p in_values, and fills @p out_values with
+ *  the values received, keyed by their source. Unlike @c all_to_all,
+ *  no process needs to know what it will receive, and the cost scales
+ *  with the number of messages actually sent rather than with the
+ *  size of the communicator: there is no exchange of sizes.
+ *
+ *  It uses the non-blocking consensus algorithm: each process sends
+ *  its messages with @c MPI_Issend, receives whatever arrives with @c
+ *  MPI_Iprobe, and enters a non-blocking barrier (@c MPI_Ibarrier)
+ *  once its own messages have been matched. When that barrier
+ *  completes, all the messages have been received.
+ *
+ *  Values with an associated MPI datatype, and vectors of them, are
+ *  sent as they are; other types are serialized.
+ *
+ *    @param comm The communicator over which the exchange will
+ *    occur.
+ *
+ *    @param in_values The values to send, keyed by the rank of their
+ *    destination.
+ *
+ *    @param out_values The values received, keyed by the rank of
+ *    their source. Its previous content is discarded.
+ */
+template<typename T>
+void
+sparse_all_to_all(const communicator& comm, const std::map<int, T>& in_values,
+                  std::map<int, T>& out_values);
+
+/**
+ * \overload
+ */
+template<typename T>
+void
+sparse_all_to_all(const communicator& comm,
+                  const std::map<int, std::vector<T> >& in_values,
+                  std::map<int, std::vector<T> >& out_values);
+#endif // BOOST_MPI_VERSION >= 3
+
 } } // end namespace boost::mpi
 #endif // BOOST_MPI_COLLECTIVES_HPP
 
@@ -735,12 +1229,19 @@ scan(const communicator& comm, const T* in_values, int n, T* out_values, Op op);
 #  include <boost/mpi/collectives/all_gatherv.hpp>
 #  include <boost/mpi/collectives/all_reduce.hpp>
 #  include <boost/mpi/collectives/all_to_all.hpp>
+#  include <boost/mpi/collectives/all_to_allv.hpp>
 #  include <boost/mpi/collectives/broadcast.hpp>
 #  include <boost/mpi/collectives/gather.hpp>
 #  include <boost/mpi/collectives/gatherv.hpp>
+#  include <boost/mpi/collectives/neighbor_all_gather.hpp>
+#  include <boost/mpi/collectives/neighbor_all_to_all.hpp>
 #  include <boost/mpi/collectives/scatter.hpp>
 #  include <boost/mpi/collectives/scatterv.hpp>
 #  include <boost/mpi/collectives/reduce.hpp>
+#  include <boost/mpi/collectives/reduce_scatter.hpp>
 #  include <boost/mpi/collectives/scan.hpp>
+#  include <boost/mpi/collectives/sparse_all_to_all.hpp>
+#  include <boost/mpi/collectives/streaming_gather.hpp>
+#  include <boost/mpi/collectives/streaming_scatter.hpp>
 #endif
 
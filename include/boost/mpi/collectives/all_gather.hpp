@@ -19,7 +19,9 @@
 #include <boost/mpi/detail/point_to_point.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <boost/mpi/collective_plan.hpp>
 #include <boost/mpi/detail/offsets.hpp>
+#include <boost/mpi/detail/speculative_collectives.hpp>
 #include <boost/mpi/detail/antiques.hpp>
 #include <boost/assert.hpp>
 
@@ -45,7 +47,8 @@ all_gather_impl(const communicator& comm, const T* in_values, int n,
 template<typename T>
 void
 all_gather_impl(const communicator& comm, const T* in_values, int n, 
-                T* out_values, int const* sizes, int const* skips, mpl::false_)
+                T* out_values, int const* sizes, int const* skips, mpl::false_,
+                collective_plan* plan = 0)
 {
   int nproc = comm.size();
   // first, gather all size, these size can be different for
@@ -55,22 +58,32 @@ all_gather_impl(const communicator& comm, const T* in_values, int n,
     oa << in_values[i];
   }
   std::vector<int> oasizes(nproc);
-  int oasize = oa.size();
-  BOOST_MPI_CHECK_RESULT(MPI_Allgather,
-                         (&oasize, 1, MPI_INT,
-                          c_data(oasizes), 1, MPI_INT, 
-                          MPI_Comm(comm)));
-  // Gather the archives, which can be of different sizes, so
-  // we need to use allgatherv.
-  // Every thing is contiguous, so the offsets can be
-  // deduced from the collected sizes.
   std::vector<int> offsets(nproc);
-  sizes2offsets(oasizes, offsets);
-  packed_iarchive::buffer_type recv_buffer(std::accumulate(oasizes.begin(), oasizes.end(), 0));
-  BOOST_MPI_CHECK_RESULT(MPI_Allgatherv,
-                         (const_cast<void*>(oa.address()), int(oa.size()), MPI_BYTE,
-                          c_data(recv_buffer), c_data(oasizes), c_data(offsets), MPI_BYTE, 
-                          MPI_Comm(comm)));
+  packed_iarchive::buffer_type recv_buffer;
+  if (plan) {
+    // One round for the archives that fit in their recorded sizes.
+    plan->all_gather(oa.address(), int(oa.size()), recv_buffer, oasizes, offsets);
+  } else if (int slot = speculative_slot(comm)) {
+    // One round for the archives that fit in a slot.
+    speculative_all_gather(comm, slot, oa.address(), int(oa.size()),
+                           recv_buffer, oasizes, offsets);
+  } else {
+    int oasize = oa.size();
+    BOOST_MPI_CHECK_RESULT(MPI_Allgather,
+                           (&oasize, 1, MPI_INT,
+                            c_data(oasizes), 1, MPI_INT, 
+                            MPI_Comm(comm)));
+    // Gather the archives, which can be of different sizes, so
+    // we need to use allgatherv.
+    // Every thing is contiguous, so the offsets can be
+    // deduced from the collected sizes.
+    sizes2offsets(oasizes, offsets);
+    recv_buffer.resize(std::accumulate(oasizes.begin(), oasizes.end(), 0));
+    BOOST_MPI_CHECK_RESULT(MPI_Allgatherv,
+                           (const_cast<void*>(oa.address()), int(oa.size()), MPI_BYTE,
+                            c_data(recv_buffer), c_data(oasizes), c_data(offsets), MPI_BYTE, 
+                            MPI_Comm(comm)));
+  }
   for (int src = 0; src < nproc; ++src) {
     int nb   = sizes ? sizes[src] : n;
     int skip = skips ? skips[src] : 0;
@@ -98,6 +111,24 @@ all_gather_impl(const communicator& comm, const T* in_values, int n,
 {
   all_gather_impl(comm, in_values, n, out_values, (int const*)0, (int const*)0, isnt_mpi_type);
 }
+
+// Plans only help the values that are serialized.
+template<typename T>
+void
+all_gather_impl(collective_plan& plan, const T* in_values, int n,
+                T* out_values, mpl::true_ is_mpi_type)
+{
+  all_gather_impl(plan.comm(), in_values, n, out_values, is_mpi_type);
+}
+
+template<typename T>
+void
+all_gather_impl(collective_plan& plan, const T* in_values, int n,
+                T* out_values, mpl::false_ isnt_mpi_type)
+{
+  all_gather_impl(plan.comm(), in_values, n, out_values, (int const*)0, (int const*)0,
+                  isnt_mpi_type, &plan);
+}
 } // end namespace detail
 
 template<typename T>
@@ -132,6 +163,15 @@ all_gather(const communicator& comm, const T* in_values, int n, std::vector<T>&
   ::boost::mpi::all_gather(comm, in_values, n, c_data(out_values));
 }
 
+template<typename T>
+void
+all_gather(collective_plan& plan, const T& in_value, std::vector<T>& out_values)
+{
+  using detail::c_data;
+  out_values.resize(plan.comm().size());
+  detail::all_gather_impl(plan, &in_value, 1, c_data(out_values), is_mpi_datatype<T>());
+}
+
 } } // end namespace boost::mpi
 
 #endif // BOOST_MPI_ALL_GATHER_HPP
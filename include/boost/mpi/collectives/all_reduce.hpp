@@ -15,6 +15,7 @@
 #include <vector>
 
 #include <boost/mpi/inplace.hpp>
+#include <boost/mpi/detail/node_hierarchy.hpp>
 
 // All-reduce falls back to reduce() + broadcast() in some cases.
 #include <boost/mpi/collectives/broadcast.hpp>
@@ -70,6 +71,25 @@ namespace detail {
                   T* out_values, Op op, mpl::false_ /*is_mpi_op*/,
                   mpl::false_ /*is_mpi_datatype*/)
   {
+#if BOOST_MPI_VERSION >= 3
+    node_hierarchy const* h = active_node_hierarchy(comm);
+    if (h && (is_commutative<Op, T>::value || h->contiguous)) {
+      // Reduce within each node, combine the node results among the
+      // node leaders, and send the result back within each node.
+      std::vector<T> tmp_in;
+      if (in_values == MPI_IN_PLACE) {
+        tmp_in.assign(out_values, out_values + n);
+        in_values = detail::c_data(tmp_in);
+      }
+      reduce(h->node, in_values, n, out_values, op, 0);
+      if (h->leaders) {
+        std::vector<T> node_values(out_values, out_values + n);
+        all_reduce(h->leaders, detail::c_data(node_values), n, out_values, op);
+      }
+      broadcast(h->node, out_values, n, 0);
+      return;
+    }
+#endif
     if (in_values == MPI_IN_PLACE) {
       // if in_values matches the in place tag, then the output
       // buffer actually contains the input data.
@@ -0,0 +1,248 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 1.1 -- Section 4.8. All-to-All (v variant)
+#ifndef BOOST_MPI_ALL_TO_ALLV_HPP
+#define BOOST_MPI_ALL_TO_ALLV_HPP
+
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/collectives_fwd.hpp>
+#include <boost/mpi/allocator.hpp>
+#include <boost/mpi/detail/offsets.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  // We're performing an all-to-all with a type that has an
+  // associated MPI datatype, so we'll use MPI_Alltoallv to do all of
+  // the work.
+  template<typename T>
+  void
+  all_to_allv_impl(const communicator& comm,
+                   const T* in_values, int const* in_sizes, int const* in_displs,
+                   T* out_values, int const* out_sizes, int const* out_displs,
+                   mpl::true_)
+  {
+    MPI_Datatype type = get_mpi_datatype<T>();
+    BOOST_MPI_CHECK_RESULT(MPI_Alltoallv,
+                           (const_cast<T*>(in_values), const_cast<int*>(in_sizes),
+                            const_cast<int*>(in_displs), type,
+                            out_values, const_cast<int*>(out_sizes),
+                            const_cast<int*>(out_displs), type,
+                            comm));
+  }
+
+  // Transmit one buffer of packed archives per destination, as
+  // delimited by send_sizes, and receive the archives of every
+  // source in incoming, at recv_disps.
+  inline void
+  all_to_all_packed(const communicator& comm,
+                    std::vector<char, allocator<char> >& outgoing,
+                    std::vector<int>& send_sizes,
+                    std::vector<char, allocator<char> >& incoming,
+                    std::vector<int>& recv_disps)
+  {
+    int size = comm.size();
+    std::vector<int> send_disps(size);
+    sizes2offsets(send_sizes, send_disps);
+
+    // Determine how much data each process will receive.
+    std::vector<int> recv_sizes(size);
+    all_to_all(comm, send_sizes, recv_sizes);
+    recv_disps.resize(size);
+    sizes2offsets(recv_sizes, recv_disps);
+    int sum = recv_disps[size-1] + recv_sizes[size-1];
+    incoming.resize(sum > 0 ? sum : 1);
+
+    // Make sure we don't try to reference an empty vector
+    if (outgoing.empty())
+      outgoing.push_back(0);
+
+    BOOST_MPI_CHECK_RESULT(MPI_Alltoallv,
+                           (c_data(outgoing), c_data(send_sizes),
+                            c_data(send_disps), MPI_PACKED,
+                            c_data(incoming), c_data(recv_sizes),
+                            c_data(recv_disps), MPI_PACKED,
+                            comm));
+  }
+
+  // We're performing an all-to-all with a type that does not have an
+  // associated MPI datatype, so we'll need to serialize it, in one
+  // archive per destination.
+  template<typename T>
+  void
+  all_to_allv_impl(const communicator& comm,
+                   const T* in_values, int const* in_sizes, int const* in_displs,
+                   T* out_values, int const* out_sizes, int const* out_displs,
+                   mpl::false_)
+  {
+    int size = comm.size();
+    int rank = comm.rank();
+
+    // Pack the buffer with all of the outgoing values.
+    std::vector<char, allocator<char> > outgoing;
+    std::vector<int> send_sizes(size);
+    for (int dest = 0; dest < size; ++dest) {
+      std::size_t start = outgoing.size();
+      // Our own values will never be transmitted, so don't pack them.
+      if (dest != rank) {
+        packed_oarchive oa(comm, outgoing);
+        for (int i = 0; i < in_sizes[dest]; ++i)
+          oa << in_values[in_displs[dest] + i];
+      }
+      send_sizes[dest] = outgoing.size() - start;
+    }
+
+    std::vector<char, allocator<char> > incoming;
+    std::vector<int> recv_disps;
+    all_to_all_packed(comm, outgoing, send_sizes, incoming, recv_disps);
+
+    // Deserialize data from the iarchives
+    for (int src = 0; src < size; ++src) {
+      if (src == rank) {
+        BOOST_ASSERT(in_sizes[rank] == out_sizes[rank]);
+        std::copy(in_values + in_displs[rank], in_values + in_displs[rank] + in_sizes[rank],
+                  out_values + out_displs[rank]);
+      } else {
+        packed_iarchive ia(comm, incoming, boost::archive::no_header,
+                           recv_disps[src]);
+        for (int i = 0; i < out_sizes[src]; ++i)
+          ia >> out_values[out_displs[src] + i];
+      }
+    }
+  }
+
+  // The receivers do not know how many values they will get. For MPI
+  // datatypes, the counts are exchanged first.
+  template<typename T>
+  void
+  all_to_allv_impl(const communicator& comm, const std::vector<T>& in_values,
+                   const std::vector<int>& in_sizes,
+                   std::vector<T>& out_values, std::vector<int>& out_sizes,
+                   mpl::true_ is_mpi_type)
+  {
+    int size = comm.size();
+    out_sizes.resize(size);
+    all_to_all(comm, in_sizes, out_sizes);
+    std::vector<int> in_displs(size);
+    sizes2offsets(in_sizes, in_displs);
+    std::vector<int> out_displs(size);
+    sizes2offsets(out_sizes, out_displs);
+    out_values.resize(out_displs[size-1] + out_sizes[size-1]);
+    all_to_allv_impl(comm, c_data(in_values), c_data(in_sizes), c_data(in_displs),
+                     c_data(out_values), c_data(out_sizes), c_data(out_displs),
+                     is_mpi_type);
+  }
+
+  // For serialized types, each archive starts with its number of
+  // values: the byte counts exchanged anyway make a separate exchange
+  // of the value counts unnecessary.
+  template<typename T>
+  void
+  all_to_allv_impl(const communicator& comm, const std::vector<T>& in_values,
+                   const std::vector<int>& in_sizes,
+                   std::vector<T>& out_values, std::vector<int>& out_sizes,
+                   mpl::false_)
+  {
+    int size = comm.size();
+    int rank = comm.rank();
+    std::vector<int> in_displs(size);
+    sizes2offsets(in_sizes, in_displs);
+
+    std::vector<char, allocator<char> > outgoing;
+    std::vector<int> send_sizes(size);
+    for (int dest = 0; dest < size; ++dest) {
+      std::size_t start = outgoing.size();
+      if (dest != rank) {
+        packed_oarchive oa(comm, outgoing);
+        oa << in_sizes[dest];
+        for (int i = 0; i < in_sizes[dest]; ++i)
+          oa << in_values[in_displs[dest] + i];
+      }
+      send_sizes[dest] = outgoing.size() - start;
+    }
+
+    std::vector<char, allocator<char> > incoming;
+    std::vector<int> recv_disps;
+    all_to_all_packed(comm, outgoing, send_sizes, incoming, recv_disps);
+
+    out_values.clear();
+    out_sizes.resize(size);
+    for (int src = 0; src < size; ++src) {
+      if (src == rank) {
+        out_sizes[src] = in_sizes[rank];
+        out_values.insert(out_values.end(), in_values.begin() + in_displs[rank],
+                          in_values.begin() + in_displs[rank] + in_sizes[rank]);
+      } else {
+        packed_iarchive ia(comm, incoming, boost::archive::no_header,
+                           recv_disps[src]);
+        ia >> out_sizes[src];
+        std::size_t first = out_values.size();
+        out_values.resize(first + out_sizes[src]);
+        for (int i = 0; i < out_sizes[src]; ++i)
+          ia >> out_values[first + i];
+      }
+    }
+  }
+} // end namespace detail
+
+template<typename T>
+void
+all_to_allv(const communicator& comm,
+            const T* in_values, const std::vector<int>& in_sizes,
+            const std::vector<int>& in_displs,
+            T* out_values, const std::vector<int>& out_sizes,
+            const std::vector<int>& out_displs)
+{
+  using detail::c_data;
+  BOOST_ASSERT(int(in_sizes.size()) == comm.size());
+  BOOST_ASSERT(int(in_displs.size()) == comm.size());
+  BOOST_ASSERT(int(out_sizes.size()) == comm.size());
+  BOOST_ASSERT(int(out_displs.size()) == comm.size());
+  detail::all_to_allv_impl(comm, in_values, c_data(in_sizes), c_data(in_displs),
+                           out_values, c_data(out_sizes), c_data(out_displs),
+                           is_mpi_datatype<T>());
+}
+
+template<typename T>
+void
+all_to_allv(const communicator& comm,
+            const T* in_values, const std::vector<int>& in_sizes,
+            T* out_values, const std::vector<int>& out_sizes)
+{
+  std::vector<int> in_displs(in_sizes.size());
+  detail::sizes2offsets(in_sizes, in_displs);
+  std::vector<int> out_displs(out_sizes.size());
+  detail::sizes2offsets(out_sizes, out_displs);
+  ::boost::mpi::all_to_allv(comm, in_values, in_sizes, in_displs,
+                            out_values, out_sizes, out_displs);
+}
+
+template<typename T>
+void
+all_to_allv(const communicator& comm,
+            const std::vector<T>& in_values, const std::vector<int>& in_sizes,
+            std::vector<T>& out_values, std::vector<int>& out_sizes)
+{
+  BOOST_ASSERT(int(in_sizes.size()) == comm.size());
+  BOOST_ASSERT(std::size_t(std::accumulate(in_sizes.begin(), in_sizes.end(), 0))
+               == in_values.size());
+  detail::all_to_allv_impl(comm, in_values, in_sizes, out_values, out_sizes,
+                           is_mpi_datatype<T>());
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_ALL_TO_ALLV_HPP
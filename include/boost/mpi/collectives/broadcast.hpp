@@ -12,6 +12,9 @@
 #include <boost/mpi/exception.hpp>
 #include <boost/mpi/datatype.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <boost/mpi/detail/node_hierarchy.hpp>
+#include <boost/mpi/detail/speculative_collectives.hpp>
+#include <cstddef>
 
 namespace boost { namespace mpi {
 
@@ -102,12 +105,49 @@ namespace detail {
   }
 
   // We're sending a type that does not have an associated MPI
-  // datatype, so we'll need to serialize it.
+  // datatype, so we'll need to serialize it. With a slot, the archive
+  // is broadcast in a slot of that many bytes along with its size,
+  // followed by the rest if it did not fit; otherwise, after its size.
   template<typename T>
   void
-  broadcast_impl(const communicator& comm, T* values, int n, int root, 
-                 mpl::false_ non_mpi_datatype)
+  broadcast_impl(const communicator& comm, T* values, int n, int root, int slot,
+                 mpl::false_)
   {
+#if BOOST_MPI_VERSION >= 3
+    if (node_hierarchy const* h = active_node_hierarchy(comm)) {
+      // Only one process per node receives the archive from another node.
+      packed_oarchive::buffer_type buffer;
+      if (comm.rank() == root) {
+        packed_oarchive oa(comm, buffer);
+        for (int i = 0; i < n; ++i) {
+          oa << values[i];
+        }
+      }
+      hierarchical_broadcast(*h, root, buffer);
+      if (comm.rank() != root) {
+        packed_iarchive ia(comm, buffer);
+        for (int i = 0; i < n; ++i)
+          ia >> values[i];
+      }
+      return;
+    }
+#endif
+    if (slot > 0) {
+      packed_oarchive::buffer_type buffer;
+      if (comm.rank() == root) {
+        packed_oarchive oa(comm, buffer);
+        for (int i = 0; i < n; ++i) {
+          oa << values[i];
+        }
+      }
+      speculative_broadcast(comm, root, slot, buffer);
+      if (comm.rank() != root) {
+        packed_iarchive ia(comm, buffer);
+        for (int i = 0; i < n; ++i)
+          ia >> values[i];
+      }
+      return;
+    }
     // Implementation proposed by Lorenz Hübschle-Schneider
     if (comm.rank() == root) {
       packed_oarchive oa(comm);
@@ -135,6 +175,23 @@ namespace detail {
         ia >> values[i];
     }
   }
+
+  template<typename T>
+  void
+  broadcast_impl(const communicator& comm, T* values, int n, int root,
+                 mpl::false_ non_mpi_datatype)
+  {
+    broadcast_impl(comm, values, n, root, speculative_slot(comm), non_mpi_datatype);
+  }
+
+  // The size hint does not matter for MPI datatypes.
+  template<typename T>
+  void
+  broadcast_impl(const communicator& comm, T* values, int n, int root, int /*slot*/,
+                 mpl::true_ is_mpi_type)
+  {
+    broadcast_impl(comm, values, n, root, is_mpi_type);
+  }
 } // end namespace detail
 
 template<typename T>
@@ -149,6 +206,13 @@ void broadcast(const communicator& comm, T* values, int n, int root)
   detail::broadcast_impl(comm, values, n, root, is_mpi_datatype<T>());
 }
 
+template<typename T>
+void broadcast(const communicator& comm, T& value, int root, std::size_t size_hint)
+{
+  detail::broadcast_impl(comm, &value, 1, root, detail::hinted_slot(size_hint),
+                         is_mpi_datatype<T>());
+}
+
 } } // end namespace boost::mpi
 
 // If the user has already included skeleton_and_content.hpp, include
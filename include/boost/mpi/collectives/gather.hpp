@@ -19,8 +19,11 @@
 #include <boost/mpi/detail/point_to_point.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <boost/mpi/collective_plan.hpp>
 #include <boost/mpi/detail/offsets.hpp>
 #include <boost/mpi/detail/antiques.hpp>
+#include <boost/mpi/detail/node_hierarchy.hpp>
+#include <boost/mpi/detail/speculative_collectives.hpp>
 #include <boost/assert.hpp>
 
 namespace boost { namespace mpi {
@@ -56,7 +59,8 @@ gather_impl(const communicator& comm, const T* in_values, int n, int root,
 template<typename T>
 void
 gather_impl(const communicator& comm, const T* in_values, int n, T* out_values, 
-            int const* nslot, int const* nskip, int root, mpl::false_)
+            int const* nslot, int const* nskip, int root, mpl::false_,
+            collective_plan* plan = 0)
 {
   int nproc = comm.size();
   // first, gather all size, these size can be different for
@@ -66,23 +70,42 @@ gather_impl(const communicator& comm, const T* in_values, int n, T* out_values,
     oa << in_values[i];
   }
   bool is_root = comm.rank() == root;
-  std::vector<int> oasizes(is_root ? nproc : 0);
-  int oasize = oa.size();
-  BOOST_MPI_CHECK_RESULT(MPI_Gather,
-                         (&oasize, 1, MPI_INT,
-                          c_data(oasizes), 1, MPI_INT, 
-                          root, MPI_Comm(comm)));
-  // Gather the archives, which can be of different sizes, so
-  // we need to use gatherv.
-  // Everything is contiguous (in the transmitted archive), so 
-  // the offsets can be deduced from the collected sizes.
+  std::vector<int> oasizes;
   std::vector<int> offsets;
-  if (is_root) sizes2offsets(oasizes, offsets);
-  packed_iarchive::buffer_type recv_buffer(is_root ? std::accumulate(oasizes.begin(), oasizes.end(), 0) : 0);
-  BOOST_MPI_CHECK_RESULT(MPI_Gatherv,
-                         (const_cast<void*>(oa.address()), int(oa.size()), MPI_BYTE,
-                          c_data(recv_buffer), c_data(oasizes), c_data(offsets), MPI_BYTE, 
-                          root, MPI_Comm(comm)));
+  packed_iarchive::buffer_type recv_buffer;
+  if (plan) {
+    // One round for the archives that fit in their recorded sizes.
+    plan->gather(root, oa.address(), int(oa.size()), recv_buffer, oasizes, offsets);
+  } else
+#if BOOST_MPI_VERSION >= 3
+  if (node_hierarchy const* h = active_node_hierarchy(comm)) {
+    // Gather within each node, then only ship one message per node.
+    hierarchical_gather(*h, root, oa.address(), int(oa.size()),
+                        recv_buffer, oasizes, offsets);
+  } else
+#endif
+  if (int slot = speculative_slot(comm)) {
+    // One round for the archives that fit in a slot.
+    speculative_gather(comm, root, slot, oa.address(), int(oa.size()),
+                       recv_buffer, oasizes, offsets);
+  } else {
+    oasizes.resize(is_root ? nproc : 0);
+    int oasize = oa.size();
+    BOOST_MPI_CHECK_RESULT(MPI_Gather,
+                           (&oasize, 1, MPI_INT,
+                            c_data(oasizes), 1, MPI_INT, 
+                            root, MPI_Comm(comm)));
+    // Gather the archives, which can be of different sizes, so
+    // we need to use gatherv.
+    // Everything is contiguous (in the transmitted archive), so 
+    // the offsets can be deduced from the collected sizes.
+    if (is_root) sizes2offsets(oasizes, offsets);
+    recv_buffer.resize(is_root ? std::accumulate(oasizes.begin(), oasizes.end(), 0) : 0);
+    BOOST_MPI_CHECK_RESULT(MPI_Gatherv,
+                           (const_cast<void*>(oa.address()), int(oa.size()), MPI_BYTE,
+                            c_data(recv_buffer), c_data(oasizes), c_data(offsets), MPI_BYTE, 
+                            root, MPI_Comm(comm)));
+  }
   if (is_root) {
     for (int src = 0; src < nproc; ++src) {
       // handle variadic case
@@ -114,6 +137,24 @@ gather_impl(const communicator& comm, const T* in_values, int n, T* out_values,i
 {
   gather_impl(comm, in_values, n, out_values, (int const*)0, (int const*)0, root, is_mpi_type);
 }
+
+// Plans only help the values that are serialized.
+template<typename T>
+void
+gather_impl(collective_plan& plan, const T* in_values, int n, T* out_values, int root,
+            mpl::true_ is_mpi_type)
+{
+  gather_impl(plan.comm(), in_values, n, out_values, root, is_mpi_type);
+}
+
+template<typename T>
+void
+gather_impl(collective_plan& plan, const T* in_values, int n, T* out_values, int root,
+            mpl::false_ isnt_mpi_type)
+{
+  gather_impl(plan.comm(), in_values, n, out_values, (int const*)0, (int const*)0, root,
+              isnt_mpi_type, &plan);
+}
 } // end namespace detail
 
 template<typename T>
@@ -170,6 +211,16 @@ void gather(const communicator& comm, const T* in_values, int n, int root)
   detail::gather_impl(comm, in_values, n, root, is_mpi_datatype<T>());
 }
 
+template<typename T>
+void
+gather(collective_plan& plan, const T& in_value, std::vector<T>& out_values, int root)
+{
+  using detail::c_data;
+  if (plan.comm().rank() == root) {
+    out_values.resize(plan.comm().size());
+  }
+  detail::gather_impl(plan, &in_value, 1, c_data(out_values), root, is_mpi_datatype<T>());
+}
 
 } } // end namespace boost::mpi
 
@@ -17,6 +17,7 @@
 #include <boost/mpi/detail/point_to_point.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <boost/mpi/collective_plan.hpp>
 #include <boost/mpi/detail/offsets.hpp>
 #include <boost/assert.hpp>
 #include <boost/scoped_array.hpp>
@@ -59,11 +60,13 @@ namespace detail {
   template<typename T>
   void
   gatherv_impl(const communicator& comm, const T* in_values, int in_size, 
-               T* out_values, const int* sizes, const int* displs, int root, mpl::false_)
+               T* out_values, const int* sizes, const int* displs, int root, mpl::false_,
+               collective_plan* plan = 0)
   {
     // convert displacement to offsets to skip
     scoped_array<int> skipped(make_skipped_slots(comm, sizes, displs, root));
-    gather_impl(comm, in_values, in_size, out_values, sizes, skipped.get(), root, mpl::false_());
+    gather_impl(comm, in_values, in_size, out_values, sizes, skipped.get(), root, mpl::false_(),
+                plan);
   }
 
   // We're gathering at a non-root for a type that does not have an
@@ -72,10 +75,37 @@ namespace detail {
   template<typename T>
   void
   gatherv_impl(const communicator& comm, const T* in_values, int in_size, int root, 
-              mpl::false_)
+              mpl::false_, collective_plan* plan = 0)
   {
     gather_impl(comm, in_values, in_size, (T*)0,(int const*)0,(int const*)0, root,
-                mpl::false_());
+                mpl::false_(), plan);
+  }
+
+  // Plans only help the values that are serialized.
+  template<typename T>
+  void
+  gatherv_impl(collective_plan& plan, const T* in_values, int in_size,
+               T* out_values, const int* sizes, const int* displs, int root,
+               mpl::true_ is_mpi_type)
+  {
+    if (plan.comm().rank() == root)
+      gatherv_impl(plan.comm(), in_values, in_size, out_values, sizes, displs, root,
+                   is_mpi_type);
+    else
+      gatherv_impl(plan.comm(), in_values, in_size, root, is_mpi_type);
+  }
+
+  template<typename T>
+  void
+  gatherv_impl(collective_plan& plan, const T* in_values, int in_size,
+               T* out_values, const int* sizes, const int* displs, int root,
+               mpl::false_ isnt_mpi_type)
+  {
+    if (plan.comm().rank() == root)
+      gatherv_impl(plan.comm(), in_values, in_size, out_values, sizes, displs, root,
+                   isnt_mpi_type, &plan);
+    else
+      gatherv_impl(plan.comm(), in_values, in_size, root, isnt_mpi_type, &plan);
   }
 } // end namespace detail
 
@@ -142,6 +172,21 @@ gatherv(const communicator& comm, const std::vector<T>& in_values,
   ::boost::mpi::gatherv(comm, detail::c_data(in_values), in_values.size(), out_values, sizes, root);
 }
 
+template<typename T>
+void
+gatherv(collective_plan& plan, const std::vector<T>& in_values,
+        T* out_values, const std::vector<int>& sizes, int root)
+{
+  std::vector<int> displs;
+  if (plan.comm().rank() == root) {
+    displs.resize(sizes.size());
+    detail::sizes2offsets(sizes, displs);
+  }
+  detail::gatherv_impl(plan, detail::c_data(in_values), int(in_values.size()),
+                       out_values, detail::c_data(sizes), detail::c_data(displs),
+                       root, is_mpi_datatype<T>());
+}
+
 } } // end namespace boost::mpi
 
 #endif // BOOST_MPI_GATHERV_HPP
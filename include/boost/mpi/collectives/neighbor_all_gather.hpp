@@ -0,0 +1,126 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 3.0 -- Section 7.6. Neighborhood Collective Communication
+#ifndef BOOST_MPI_NEIGHBOR_ALL_GATHER_HPP
+#define BOOST_MPI_NEIGHBOR_ALL_GATHER_HPP
+
+#include <numeric>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <vector>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/dist_graph_communicator.hpp>
+#include <boost/mpi/detail/offsets.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+
+#if BOOST_MPI_VERSION >= 3
+
+namespace boost { namespace mpi {
+
+namespace detail {
+// We're gathering from the neighbors for a type that has an
+// associated MPI datatype, so we'll use MPI_Neighbor_allgather to do
+// all of the work.
+template<typename T>
+void
+neighbor_all_gather_impl(const communicator& comm, const T* in_values, int n,
+                         T* out_values, mpl::true_)
+{
+  MPI_Datatype type = get_mpi_datatype<T>(*in_values);
+  BOOST_MPI_CHECK_RESULT(MPI_Neighbor_allgather,
+                         (const_cast<T*>(in_values), n, type,
+                          out_values, n, type, comm));
+}
+
+// We're gathering from the neighbors for a type that does not have an
+// associated MPI datatype, so we'll need to serialize it. The archive
+// sizes are exchanged first, then the archives themselves.
+template<typename T>
+void
+neighbor_all_gather_impl(const communicator& comm, const T* in_values, int n,
+                         T* out_values, mpl::false_)
+{
+  int indegree, outdegree;
+  neighbor_counts(comm, indegree, outdegree);
+
+  packed_oarchive oa(comm);
+  for (int i = 0; i < n; ++i) {
+    oa << in_values[i];
+  }
+  std::vector<int> oasizes(indegree);
+  int oasize = oa.size();
+  BOOST_MPI_CHECK_RESULT(MPI_Neighbor_allgather,
+                         (&oasize, 1, MPI_INT,
+                          c_data(oasizes), 1, MPI_INT,
+                          MPI_Comm(comm)));
+  std::vector<int> offsets(indegree);
+  if (indegree > 0) {
+    sizes2offsets(oasizes, offsets);
+  }
+  packed_iarchive::buffer_type recv_buffer(std::accumulate(oasizes.begin(), oasizes.end(), 0));
+  BOOST_MPI_CHECK_RESULT(MPI_Neighbor_allgatherv,
+                         (const_cast<void*>(oa.address()), int(oa.size()), MPI_BYTE,
+                          c_data(recv_buffer), c_data(oasizes), c_data(offsets), MPI_BYTE,
+                          MPI_Comm(comm)));
+  for (int src = 0; src < indegree; ++src) {
+    // Nothing comes from MPI_PROC_NULL (the borders of a non periodic
+    // cartesian topology): leave these values untouched, as MPI does.
+    if (oasizes[src] == 0) {
+      continue;
+    }
+    packed_iarchive ia(comm, recv_buffer, boost::archive::no_header, offsets[src]);
+    for (int i = 0; i < n; ++i) {
+      ia >> out_values[src * n + i];
+    }
+  }
+}
+} // end namespace detail
+
+template<typename T>
+void
+neighbor_all_gather(const communicator& comm, const T& in_value, T* out_values)
+{
+  detail::neighbor_all_gather_impl(comm, &in_value, 1, out_values, is_mpi_datatype<T>());
+}
+
+template<typename T>
+void
+neighbor_all_gather(const communicator& comm, const T& in_value,
+                    std::vector<T>& out_values)
+{
+  int indegree, outdegree;
+  detail::neighbor_counts(comm, indegree, outdegree);
+  out_values.resize(indegree);
+  ::boost::mpi::neighbor_all_gather(comm, in_value, detail::c_data(out_values));
+}
+
+template<typename T>
+void
+neighbor_all_gather(const communicator& comm, const T* in_values, int n,
+                    T* out_values)
+{
+  detail::neighbor_all_gather_impl(comm, in_values, n, out_values, is_mpi_datatype<T>());
+}
+
+template<typename T>
+void
+neighbor_all_gather(const communicator& comm, const T* in_values, int n,
+                    std::vector<T>& out_values)
+{
+  int indegree, outdegree;
+  detail::neighbor_counts(comm, indegree, outdegree);
+  out_values.resize(indegree * n);
+  ::boost::mpi::neighbor_all_gather(comm, in_values, n, detail::c_data(out_values));
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_VERSION >= 3
+
+#endif // BOOST_MPI_NEIGHBOR_ALL_GATHER_HPP
@@ -0,0 +1,150 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 3.0 -- Section 7.6. Neighborhood Collective Communication
+#ifndef BOOST_MPI_NEIGHBOR_ALL_TO_ALL_HPP
+#define BOOST_MPI_NEIGHBOR_ALL_TO_ALL_HPP
+
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <vector>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/dist_graph_communicator.hpp>
+#include <boost/mpi/allocator.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+
+#if BOOST_MPI_VERSION >= 3
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  // We're performing a neighborhood all-to-all with a type that has
+  // an associated MPI datatype, so we'll use MPI_Neighbor_alltoall to
+  // do all of the work.
+  template<typename T>
+  void
+  neighbor_all_to_all_impl(const communicator& comm, const T* in_values, int n,
+                           T* out_values, mpl::true_)
+  {
+    MPI_Datatype type = get_mpi_datatype<T>(*in_values);
+    BOOST_MPI_CHECK_RESULT(MPI_Neighbor_alltoall,
+                           (const_cast<T*>(in_values), n, type,
+                            out_values, n, type, comm));
+  }
+
+  // We're performing a neighborhood all-to-all with a type that does
+  // not have an associated MPI datatype, so we'll need to serialize
+  // it, one archive per destination, as all_to_all does.
+  template<typename T>
+  void
+  neighbor_all_to_all_impl(const communicator& comm, const T* in_values, int n,
+                           T* out_values, mpl::false_)
+  {
+    int indegree, outdegree;
+    neighbor_counts(comm, indegree, outdegree);
+
+    // The amount of data to be sent to each neighbor, and the
+    // displacements for each outgoing value.
+    std::vector<int> send_sizes(outdegree);
+    std::vector<int> send_disps(outdegree);
+
+    // The buffer that will store all of the outgoing values
+    std::vector<char, allocator<char> > outgoing;
+
+    // Pack the buffer with all of the outgoing values.
+    for (int dest = 0; dest < outdegree; ++dest) {
+      send_disps[dest] = outgoing.size();
+      packed_oarchive oa(comm, outgoing);
+      for (int i = 0; i < n; ++i)
+        oa << in_values[dest * n + i];
+      send_sizes[dest] = outgoing.size() - send_disps[dest];
+    }
+
+    // Determine how much data each neighbor will send us.
+    std::vector<int> recv_sizes(indegree);
+    BOOST_MPI_CHECK_RESULT(MPI_Neighbor_alltoall,
+                           (c_data(send_sizes), 1, MPI_INT,
+                            c_data(recv_sizes), 1, MPI_INT, comm));
+
+    // Prepare a buffer to receive the incoming data.
+    std::vector<int> recv_disps(indegree);
+    int sum = 0;
+    for (int src = 0; src < indegree; ++src) {
+      recv_disps[src] = sum;
+      sum += recv_sizes[src];
+    }
+    std::vector<char, allocator<char> > incoming(sum > 0? sum : 1);
+
+    // Make sure we don't try to reference an empty vector
+    if (outgoing.empty())
+      outgoing.push_back(0);
+
+    // Transmit the actual data
+    BOOST_MPI_CHECK_RESULT(MPI_Neighbor_alltoallv,
+                           (c_data(outgoing), c_data(send_sizes),
+                            c_data(send_disps), MPI_PACKED,
+                            c_data(incoming), c_data(recv_sizes),
+                            c_data(recv_disps), MPI_PACKED,
+                            comm));
+
+    // Deserialize data from the iarchive
+    for (int src = 0; src < indegree; ++src) {
+      // Nothing comes from MPI_PROC_NULL: leave these values untouched.
+      if (recv_sizes[src] == 0)
+        continue;
+      packed_iarchive ia(comm, incoming, boost::archive::no_header,
+                         recv_disps[src]);
+      for (int i = 0; i < n; ++i)
+        ia >> out_values[src * n + i];
+    }
+  }
+} // end namespace detail
+
+template<typename T>
+inline void
+neighbor_all_to_all(const communicator& comm, const T* in_values, T* out_values)
+{
+  detail::neighbor_all_to_all_impl(comm, in_values, 1, out_values, is_mpi_datatype<T>());
+}
+
+template<typename T>
+void
+neighbor_all_to_all(const communicator& comm, const std::vector<T>& in_values,
+                    std::vector<T>& out_values)
+{
+  int indegree, outdegree;
+  detail::neighbor_counts(comm, indegree, outdegree);
+  BOOST_ASSERT((int)in_values.size() == outdegree);
+  out_values.resize(indegree);
+  ::boost::mpi::neighbor_all_to_all(comm, detail::c_data(in_values), detail::c_data(out_values));
+}
+
+template<typename T>
+inline void
+neighbor_all_to_all(const communicator& comm, const T* in_values, int n, T* out_values)
+{
+  detail::neighbor_all_to_all_impl(comm, in_values, n, out_values, is_mpi_datatype<T>());
+}
+
+template<typename T>
+void
+neighbor_all_to_all(const communicator& comm, const std::vector<T>& in_values, int n,
+                    std::vector<T>& out_values)
+{
+  int indegree, outdegree;
+  detail::neighbor_counts(comm, indegree, outdegree);
+  BOOST_ASSERT((int)in_values.size() == outdegree * n);
+  out_values.resize(indegree * n);
+  ::boost::mpi::neighbor_all_to_all(comm, detail::c_data(in_values), n, detail::c_data(out_values));
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_VERSION >= 3
+
+#endif // BOOST_MPI_NEIGHBOR_ALL_TO_ALL_HPP
@@ -0,0 +1,211 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 1.1 -- Section 4.10. Reduce-Scatter
+#ifndef BOOST_MPI_REDUCE_SCATTER_HPP
+#define BOOST_MPI_REDUCE_SCATTER_HPP
+
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/datatype.hpp>
+
+// For (de-)serializing sends and receives
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+
+// For packed_[io]archive sends and receives
+#include <boost/mpi/detail/point_to_point.hpp>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/operations.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  /**********************************************************************
+   * Simple reduce-scatter with MPI_Reduce_scatter                      *
+   **********************************************************************/
+  // We are reducing for a type that has an associated MPI datatype
+  // and operation, so we'll use MPI_Reduce_scatter directly.
+  template<typename T, typename Op>
+  void
+  reduce_scatter_impl(const communicator& comm, const T* in_values, int const* sizes,
+                      T* out_values, Op /*op*/, mpl::true_ /*is_mpi_op*/,
+                      mpl::true_ /*is_mpi_datatype*/)
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Reduce_scatter,
+                           (const_cast<T*>(in_values), out_values,
+                            const_cast<int*>(sizes), get_mpi_datatype<T>(),
+                            (is_mpi_op<Op, T>::op()), comm));
+  }
+
+  template<typename T, typename Op>
+  void
+  reduce_scatter_block_impl(const communicator& comm, const T* in_values, int n,
+                            T* out_values, Op /*op*/, mpl::true_ /*is_mpi_op*/,
+                            mpl::true_ /*is_mpi_datatype*/)
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Reduce_scatter_block,
+                           (const_cast<T*>(in_values), out_values, n,
+                            get_mpi_datatype<T>(), (is_mpi_op<Op, T>::op()), comm));
+  }
+
+  /**********************************************************************
+   * User-defined reduce-scatter with MPI_Reduce_scatter                *
+   **********************************************************************/
+  // We are reducing for a type that has an associated MPI datatype
+  // but with a custom operation. We'll use MPI_Reduce_scatter
+  // directly, but we'll need to create an MPI_Op manually.
+  template<typename T, typename Op>
+  void
+  reduce_scatter_impl(const communicator& comm, const T* in_values, int const* sizes,
+                      T* out_values, Op /*op*/, mpl::false_ /*is_mpi_op*/,
+                      mpl::true_ /*is_mpi_datatype*/)
+  {
+    user_op<Op, T> mpi_op;
+    BOOST_MPI_CHECK_RESULT(MPI_Reduce_scatter,
+                           (const_cast<T*>(in_values), out_values,
+                            const_cast<int*>(sizes), get_mpi_datatype<T>(),
+                            mpi_op.get_mpi_op(), comm));
+  }
+
+  template<typename T, typename Op>
+  void
+  reduce_scatter_block_impl(const communicator& comm, const T* in_values, int n,
+                            T* out_values, Op /*op*/, mpl::false_ /*is_mpi_op*/,
+                            mpl::true_ /*is_mpi_datatype*/)
+  {
+    user_op<Op, T> mpi_op;
+    BOOST_MPI_CHECK_RESULT(MPI_Reduce_scatter_block,
+                           (const_cast<T*>(in_values), out_values, n,
+                            get_mpi_datatype<T>(), mpi_op.get_mpi_op(), comm));
+  }
+
+  /**********************************************************************
+   * User-defined, pairwise reduce-scatter for non-MPI data types       *
+   **********************************************************************/
+  // We are reducing for a type that has no associated MPI datatype
+  // and operation, so we'll use a pairwise exchange: at step k, each
+  // process sends the values for process rank+k and receives those
+  // of process rank-k for itself. Each process only ever receives its
+  // own block. The contributions of lower ranks arrive in decreasing
+  // order and are combined on the left of our own; those of higher
+  // ranks are combined apart and appended last, which keeps the rank
+  // order for non-commutative operations.
+  template<typename T, typename Op>
+  void
+  reduce_scatter_impl(const communicator& comm, const T* in_values, int const* sizes,
+                      T* out_values, Op op, mpl::false_ /*is_mpi_op*/,
+                      mpl::false_ /*is_mpi_datatype*/)
+  {
+    int size = comm.size();
+    int rank = comm.rank();
+    int tag = environment::collectives_tag();
+
+    std::vector<int> displs(size);
+    for (int p = 1; p < size; ++p)
+      displs[p] = displs[p-1] + sizes[p-1];
+
+    int n = sizes[rank];
+    std::copy(in_values + displs[rank], in_values + displs[rank] + n, out_values);
+
+    // The reduction of the values of the processes after us.
+    std::vector<T> after;
+    MPI_Status status;
+    for (int k = 1; k < size; ++k) {
+      int dest = (rank + k) % size;
+      int src = (rank + size - k) % size;
+
+      packed_oarchive oa(comm);
+      for (int i = 0; i < sizes[dest]; ++i)
+        oa << in_values[displs[dest] + i];
+      request sent = detail::packed_archive_isend(comm, dest, tag, oa);
+
+      packed_iarchive ia(comm);
+      detail::packed_archive_recv(comm, src, tag, ia, status);
+      T incoming;
+      if (src < rank) {
+        for (int i = 0; i < n; ++i) {
+          ia >> incoming;
+          out_values[i] = op(incoming, out_values[i]);
+        }
+      } else if (after.empty()) {
+        after.resize(n);
+        for (int i = 0; i < n; ++i)
+          ia >> after[i];
+      } else {
+        for (int i = 0; i < n; ++i) {
+          ia >> incoming;
+          after[i] = op(incoming, after[i]);
+        }
+      }
+      sent.wait();
+    }
+    for (std::size_t i = 0; i < after.size(); ++i)
+      out_values[i] = op(out_values[i], after[i]);
+  }
+
+  template<typename T, typename Op>
+  void
+  reduce_scatter_block_impl(const communicator& comm, const T* in_values, int n,
+                            T* out_values, Op op, mpl::false_ is_mpi_op,
+                            mpl::false_ is_mpi_datatype)
+  {
+    std::vector<int> sizes(comm.size(), n);
+    reduce_scatter_impl(comm, in_values, c_data(sizes), out_values, op,
+                        is_mpi_op, is_mpi_datatype);
+  }
+} // end namespace detail
+
+template<typename T, typename Op>
+void
+reduce_scatter(const communicator& comm, const T* in_values,
+               const std::vector<int>& sizes, T* out_values, Op op)
+{
+  BOOST_ASSERT(int(sizes.size()) == comm.size());
+  detail::reduce_scatter_impl(comm, in_values, detail::c_data(sizes), out_values, op,
+                              is_mpi_op<Op, T>(), is_mpi_datatype<T>());
+}
+
+template<typename T, typename Op>
+void
+reduce_scatter(const communicator& comm, const std::vector<T>& in_values,
+               const std::vector<int>& sizes, std::vector<T>& out_values, Op op)
+{
+  out_values.resize(sizes[comm.rank()]);
+  ::boost::mpi::reduce_scatter(comm, detail::c_data(in_values), sizes,
+                               detail::c_data(out_values), op);
+}
+
+template<typename T, typename Op>
+void
+reduce_scatter_block(const communicator& comm, const T* in_values, int n,
+                     T* out_values, Op op)
+{
+  detail::reduce_scatter_block_impl(comm, in_values, n, out_values, op,
+                                    is_mpi_op<Op, T>(), is_mpi_datatype<T>());
+}
+
+template<typename T, typename Op>
+void
+reduce_scatter_block(const communicator& comm, const std::vector<T>& in_values,
+                     std::vector<T>& out_values, Op op)
+{
+  BOOST_ASSERT(in_values.size() % comm.size() == 0);
+  int n = int(in_values.size() / comm.size());
+  out_values.resize(n);
+  ::boost::mpi::reduce_scatter_block(comm, detail::c_data(in_values), n,
+                                     detail::c_data(out_values), op);
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_REDUCE_SCATTER_HPP
@@ -25,8 +25,12 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
 #include <boost/mpi/detail/computation_tree.hpp>
+#include <boost/mpi/detail/node_hierarchy.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/operations.hpp>
 #include <algorithm>
+#include <vector>
 #include <exception>
 #include <boost/assert.hpp>
 
@@ -124,6 +128,51 @@ namespace detail {
     }
   }
 
+#if BOOST_MPI_VERSION >= 3
+  // Prefix reduction in two levels, for nodes made of consecutive
+  // ranks: a prefix reduction within each node, a prefix reduction of
+  // the node totals among the node leaders, and a final combination
+  // within each node with the total of the preceding nodes.
+  template<typename T, typename Op>
+  void
+  hierarchical_scan(const node_hierarchy& h, const T* in_values, int n,
+                    T* out_values, Op& op)
+  {
+    int tag = environment::collectives_tag();
+    const communicator& node = h.node;
+    int last = node.size() - 1;
+    upper_lower_scan(node, in_values, n, out_values, op, 0, node.size());
+
+    // The last process of each node holds the node total.
+    if (node.rank() == last && last != 0)
+      node.send(0, tag, out_values, n);
+
+    std::vector<T> prefix(n);
+    if (h.leaders) {
+      const communicator& leaders = h.leaders;
+      std::vector<T> total(out_values, out_values + n);
+      if (last != 0)
+        node.recv(last, tag, detail::c_data(total), n);
+      std::vector<T> inclusive(n);
+      upper_lower_scan(leaders, detail::c_data(total), n, detail::c_data(inclusive),
+                       op, 0, leaders.size());
+      // Post the receive first, so that the shifts of all the leaders
+      // proceed at once rather than along a chain.
+      request shifted;
+      if (leaders.rank() > 0)
+        shifted = leaders.irecv(leaders.rank() - 1, tag, detail::c_data(prefix), n);
+      if (leaders.rank() + 1 < leaders.size())
+        leaders.send(leaders.rank() + 1, tag, detail::c_data(inclusive), n);
+      shifted.wait();
+    }
+    if (h.node_of[h.rank] > 0) {
+      broadcast(node, detail::c_data(prefix), n, 0);
+      for (int i = 0; i < n; ++i)
+        out_values[i] = op(prefix[i], out_values[i]);
+    }
+  }
+#endif
+
   // We are performing prefix reduction for a type that has no
   // associated MPI datatype and operation, so we'll use a simple
   // upper/lower algorithm.
@@ -132,6 +181,13 @@ namespace detail {
   scan_impl(const communicator& comm, const T* in_values, int n, T* out_values, 
             Op op, mpl::false_ /*is_mpi_op*/, mpl::false_/*is_mpi_datatype*/)
   {
+#if BOOST_MPI_VERSION >= 3
+    node_hierarchy const* h = active_node_hierarchy(comm);
+    if (h && h->contiguous) {
+      hierarchical_scan(*h, in_values, n, out_values, op);
+      return;
+    }
+#endif
     upper_lower_scan(comm, in_values, n, out_values, op, 0, comm.size());
   }
 } // end namespace detail
@@ -16,6 +16,7 @@
 #include <boost/mpi/detail/point_to_point.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <boost/mpi/collective_plan.hpp>
 #include <boost/mpi/detail/offsets.hpp>
 #include <boost/mpi/detail/antiques.hpp>
 #include <boost/assert.hpp>
@@ -96,23 +97,29 @@ void
 dispatch_scatter_sendbuf(const communicator& comm, 
                          packed_oarchive::buffer_type const& sendbuf, std::vector<int> const& archsizes,
                          T const* in_values,
-                         T* out_values, int n, int root) {
-  // Distribute the sizes
-  int myarchsize;
-  BOOST_MPI_CHECK_RESULT(MPI_Scatter,
-                         (non_const_data(archsizes), 1, MPI_INT,
-                          &myarchsize, 1, MPI_INT, root, comm));
-  std::vector<int> offsets;
-  if (root == comm.rank()) {
-    sizes2offsets(archsizes, offsets);
-  }
-  // Get my proc archive
+                         T* out_values, int n, int root,
+                         collective_plan* plan = 0) {
   packed_iarchive::buffer_type recvbuf;
-  recvbuf.resize(myarchsize);
-  BOOST_MPI_CHECK_RESULT(MPI_Scatterv,
-                         (non_const_data(sendbuf), non_const_data(archsizes), c_data(offsets), MPI_BYTE,
-                          c_data(recvbuf), recvbuf.size(), MPI_BYTE,
-                          root, MPI_Comm(comm)));
+  if (plan) {
+    // One round for the archives that fit in their recorded sizes.
+    plan->scatter(root, sendbuf, archsizes, recvbuf);
+  } else {
+    // Distribute the sizes
+    int myarchsize;
+    BOOST_MPI_CHECK_RESULT(MPI_Scatter,
+                           (non_const_data(archsizes), 1, MPI_INT,
+                            &myarchsize, 1, MPI_INT, root, comm));
+    std::vector<int> offsets;
+    if (root == comm.rank()) {
+      sizes2offsets(archsizes, offsets);
+    }
+    // Get my proc archive
+    recvbuf.resize(myarchsize);
+    BOOST_MPI_CHECK_RESULT(MPI_Scatterv,
+                           (non_const_data(sendbuf), non_const_data(archsizes), c_data(offsets), MPI_BYTE,
+                            c_data(recvbuf), recvbuf.size(), MPI_BYTE,
+                            root, MPI_Comm(comm)));
+  }
   // Unserialize
   if ( in_values != 0 && root == comm.rank()) {
     // Our own local values are already here: just copy them.
@@ -131,7 +138,7 @@ dispatch_scatter_sendbuf(const communicator& comm,
 template<typename T>
 void
 scatter_impl(const communicator& comm, const T* in_values, T* out_values, 
-             int n, int root, mpl::false_)
+             int n, int root, mpl::false_, collective_plan* plan = 0)
 {
   packed_oarchive::buffer_type sendbuf;
   std::vector<int> archsizes;
@@ -140,7 +147,7 @@ scatter_impl(const communicator& comm, const T* in_values, T* out_values,
     std::vector<int> nslots(comm.size(), n);
     fill_scatter_sendbuf(comm, in_values, c_data(nslots), (int const*)0, sendbuf, archsizes);
   }
-  dispatch_scatter_sendbuf(comm, sendbuf, archsizes, in_values, out_values, n, root);
+  dispatch_scatter_sendbuf(comm, sendbuf, archsizes, in_values, out_values, n, root, plan);
 }
 
 template<typename T>
@@ -150,6 +157,26 @@ scatter_impl(const communicator& comm, T* out_values, int n, int root,
 { 
   scatter_impl(comm, (T const*)0, out_values, n, root, is_mpi_type);
 }
+
+// Plans only help the values that are serialized.
+template<typename T>
+void
+scatter_impl(collective_plan& plan, const T* in_values, T* out_values,
+             int n, int root, mpl::true_ is_mpi_type)
+{
+  if (plan.comm().rank() == root)
+    scatter_impl(plan.comm(), in_values, out_values, n, root, is_mpi_type);
+  else
+    scatter_impl(plan.comm(), out_values, n, root, is_mpi_type);
+}
+
+template<typename T>
+void
+scatter_impl(collective_plan& plan, const T* in_values, T* out_values,
+             int n, int root, mpl::false_ isnt_mpi_type)
+{
+  scatter_impl(plan.comm(), in_values, out_values, n, root, isnt_mpi_type, &plan);
+}
 } // end namespace detail
 
 template<typename T>
@@ -198,6 +225,15 @@ void scatter(const communicator& comm, T* out_values, int n, int root)
   detail::scatter_impl(comm, out_values, n, root, is_mpi_datatype<T>());
 }
 
+template<typename T>
+void
+scatter(collective_plan& plan, const std::vector<T>& in_values, T& out_value,
+        int root)
+{
+  detail::scatter_impl(plan, detail::c_data(in_values), &out_value, 1, root,
+                       is_mpi_datatype<T>());
+}
+
 } } // end namespace boost::mpi
 
 #endif // BOOST_MPI_SCATTER_HPP
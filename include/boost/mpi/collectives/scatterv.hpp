@@ -60,7 +60,8 @@ scatterv_impl(const communicator& comm, T* out_values, int out_size, int root,
 template<typename T>
 void
 scatterv_impl(const communicator& comm, const T* in_values, T* out_values, int out_size,
-              int const* sizes, int const* displs, int root, mpl::false_)
+              int const* sizes, int const* displs, int root, mpl::false_,
+              collective_plan* plan = 0)
 {
   packed_oarchive::buffer_type sendbuf;
   bool is_root = comm.rank() == root;
@@ -77,7 +78,8 @@ scatterv_impl(const communicator& comm, const T* in_values, T* out_values, int o
     }
     fill_scatter_sendbuf(comm, in_values, sizes, (int const*)0, sendbuf, archsizes);
   }
-  dispatch_scatter_sendbuf(comm, sendbuf, archsizes, (T const*)0, out_values, out_size, root);
+  dispatch_scatter_sendbuf(comm, sendbuf, archsizes, (T const*)0, out_values, out_size, root,
+                           plan);
 }
 
 // We're scattering to a non-root for a type that does not have an
@@ -92,6 +94,25 @@ scatterv_impl(const communicator& comm, T* out_values, int n, int root,
   scatterv_impl(comm, (T const*)0, out_values, n, (int const*)0, (int const*)0, root, isnt_mpi_type);
 }
 
+// Plans only help the values that are serialized.
+template<typename T>
+void
+scatterv_impl(collective_plan& plan, const T* in_values, T* out_values, int out_size,
+              const int* sizes, int root, mpl::true_ is_mpi_type)
+{
+  scatterv_impl(plan.comm(), in_values, out_values, out_size, sizes, (int const*)0,
+                root, is_mpi_type);
+}
+
+template<typename T>
+void
+scatterv_impl(collective_plan& plan, const T* in_values, T* out_values, int out_size,
+              const int* sizes, int root, mpl::false_ isnt_mpi_type)
+{
+  scatterv_impl(plan.comm(), in_values, out_values, out_size, sizes, (int const*)0,
+                root, isnt_mpi_type, &plan);
+}
+
 } // end namespace detail
 
 template<typename T>
@@ -162,6 +183,16 @@ scatterv(const communicator& comm, const std::vector<T>& in_values,
   ::boost::mpi::scatterv(comm, detail::c_data(in_values), out_values, out_size, root);
 }
 
+template<typename T>
+void
+scatterv(collective_plan& plan, const std::vector<T>& in_values,
+         const std::vector<int>& sizes, T* out_values, int out_size, int root)
+{
+  using detail::c_data;
+  detail::scatterv_impl(plan, c_data(in_values), out_values, out_size,
+                        c_data(sizes), root, is_mpi_datatype<T>());
+}
+
 } } // end namespace boost::mpi
 
 #endif // BOOST_MPI_SCATTERV_HPP
@@ -0,0 +1,268 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Sparse data exchange with the non-blocking consensus (NBX) algorithm,
+// built on Message Passing Interface 3.0 -- Section 5.12.1. Nonblocking
+// Barrier Synchronization
+#ifndef BOOST_MPI_SPARSE_ALL_TO_ALL_HPP
+#define BOOST_MPI_SPARSE_ALL_TO_ALL_HPP
+
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/allocator.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <map>
+#include <vector>
+
+#if BOOST_MPI_VERSION >= 3
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  // The tag of the next sparse exchange over comm. Two exchanges in a
+  // row must use different tags: a process may start the second one
+  // while another one is still probing for the messages of the first.
+  // As each exchange completes a barrier, alternating two tags is
+  // enough.
+  BOOST_MPI_DECL int sparse_exchange_tag(const communicator& comm);
+
+  // Free the attribute key of the exchange counts. Called by the
+  // environment before finalizing MPI.
+  BOOST_MPI_DECL void release_sparse_exchange_tags();
+
+  // The non-blocking consensus: receive the messages sent with tag
+  // until all the processes know that their synchronous sends have
+  // been matched, which the completion of a non-blocking barrier
+  // entered after them tells. Only the actual neighbors exchange
+  // messages; the barrier costs O(log P).
+  template<typename Receiver>
+  void
+  sparse_exchange(const communicator& comm, int tag,
+                  std::vector<MPI_Request>& sends, Receiver& receive)
+  {
+    MPI_Request barrier = MPI_REQUEST_NULL;
+    bool in_barrier = false;
+    for (;;) {
+      int found;
+      MPI_Status status;
+      BOOST_MPI_CHECK_RESULT(MPI_Iprobe, (MPI_ANY_SOURCE, tag, comm, &found, &status));
+      if (found) {
+        receive(status);
+      }
+      if (in_barrier) {
+        int done;
+        BOOST_MPI_CHECK_RESULT(MPI_Test, (&barrier, &done, MPI_STATUS_IGNORE));
+        if (done) {
+          break;
+        }
+      } else {
+        int sent;
+        BOOST_MPI_CHECK_RESULT(MPI_Testall, (int(sends.size()), c_data(sends), &sent,
+                                             MPI_STATUSES_IGNORE));
+        if (sent) {
+          BOOST_MPI_CHECK_RESULT(MPI_Ibarrier, (comm, &barrier));
+          in_barrier = true;
+        }
+      }
+    }
+  }
+
+  // Receive one value with an associated MPI datatype per source.
+  template<typename T>
+  struct sparse_value_receiver
+  {
+    sparse_value_receiver(const communicator& comm, std::map<int, T>& values)
+      : comm(comm), values(values) {}
+
+    void operator()(MPI_Status& status)
+    {
+      BOOST_MPI_CHECK_RESULT(MPI_Recv,
+                             (&values[status.MPI_SOURCE], 1, get_mpi_datatype<T>(),
+                              status.MPI_SOURCE, status.MPI_TAG, comm, MPI_STATUS_IGNORE));
+    }
+
+    const communicator& comm;
+    std::map<int, T>&   values;
+  };
+
+  // Receive an array of values with an associated MPI datatype per
+  // source, of a size given by the message.
+  template<typename T>
+  struct sparse_array_receiver
+  {
+    sparse_array_receiver(const communicator& comm, std::map<int, std::vector<T> >& values)
+      : comm(comm), values(values) {}
+
+    void operator()(MPI_Status& status)
+    {
+      MPI_Datatype type = get_mpi_datatype<T>();
+      int count;
+      BOOST_MPI_CHECK_RESULT(MPI_Get_count, (&status, type, &count));
+      std::vector<T>& received = values[status.MPI_SOURCE];
+      received.resize(count);
+      BOOST_MPI_CHECK_RESULT(MPI_Recv,
+                             (c_data(received), count, type,
+                              status.MPI_SOURCE, status.MPI_TAG, comm, MPI_STATUS_IGNORE));
+    }
+
+    const communicator&               comm;
+    std::map<int, std::vector<T> >&   values;
+  };
+
+  // Receive one serialized value per source.
+  template<typename T>
+  struct sparse_packed_receiver
+  {
+    sparse_packed_receiver(const communicator& comm, std::map<int, T>& values)
+      : comm(comm), values(values) {}
+
+    void operator()(MPI_Status& status)
+    {
+      int count;
+      BOOST_MPI_CHECK_RESULT(MPI_Get_count, (&status, MPI_PACKED, &count));
+      packed_iarchive ia(comm);
+      ia.resize(count);
+      BOOST_MPI_CHECK_RESULT(MPI_Recv,
+                             (ia.address(), count, MPI_PACKED,
+                              status.MPI_SOURCE, status.MPI_TAG, comm, MPI_STATUS_IGNORE));
+      ia >> values[status.MPI_SOURCE];
+    }
+
+    const communicator& comm;
+    std::map<int, T>&   values;
+  };
+
+  // We're exchanging values that have an associated MPI datatype, so
+  // each is sent as is.
+  template<typename T>
+  void
+  sparse_all_to_all_impl(const communicator& comm, const std::map<int, T>& in_values,
+                         std::map<int, T>& out_values, mpl::true_)
+  {
+    int tag = sparse_exchange_tag(comm);
+    int rank = comm.rank();
+    out_values.clear();
+    std::vector<MPI_Request> sends;
+    sends.reserve(in_values.size());
+    for (typename std::map<int, T>::const_iterator it = in_values.begin();
+         it != in_values.end(); ++it) {
+      if (it->first == rank) {
+        out_values[rank] = it->second;
+      } else {
+        sends.push_back(MPI_REQUEST_NULL);
+        BOOST_MPI_CHECK_RESULT(MPI_Issend,
+                               (const_cast<T*>(&it->second), 1, get_mpi_datatype<T>(),
+                                it->first, tag, comm, &sends.back()));
+      }
+    }
+    sparse_value_receiver<T> receive(comm, out_values);
+    sparse_exchange(comm, tag, sends, receive);
+  }
+
+  // We're exchanging values that do not have an associated MPI
+  // datatype, so each is serialized in its own archive.
+  template<typename T>
+  void
+  sparse_all_to_all_impl(const communicator& comm, const std::map<int, T>& in_values,
+                         std::map<int, T>& out_values, mpl::false_)
+  {
+    int tag = sparse_exchange_tag(comm);
+    int rank = comm.rank();
+    out_values.clear();
+
+    // Pack all the archives first: the buffer must not move once the
+    // sends are posted.
+    std::vector<char, allocator<char> > outgoing;
+    std::vector<int> dests;
+    std::vector<int> offsets;
+    for (typename std::map<int, T>::const_iterator it = in_values.begin();
+         it != in_values.end(); ++it) {
+      if (it->first == rank) {
+        out_values[rank] = it->second;
+      } else {
+        dests.push_back(it->first);
+        offsets.push_back(outgoing.size());
+        packed_oarchive oa(comm, outgoing);
+        oa << it->second;
+      }
+    }
+    offsets.push_back(outgoing.size());
+
+    std::vector<MPI_Request> sends(dests.size(), MPI_REQUEST_NULL);
+    for (std::size_t i = 0; i < dests.size(); ++i) {
+      BOOST_MPI_CHECK_RESULT(MPI_Issend,
+                             (c_data(outgoing) + offsets[i], offsets[i+1] - offsets[i],
+                              MPI_PACKED, dests[i], tag, comm, &sends[i]));
+    }
+    sparse_packed_receiver<T> receive(comm, out_values);
+    sparse_exchange(comm, tag, sends, receive);
+  }
+
+  // We're exchanging arrays of values that have an associated MPI
+  // datatype, so each is sent as is, its size given by the message.
+  template<typename T>
+  void
+  sparse_all_to_all_impl(const communicator& comm,
+                         const std::map<int, std::vector<T> >& in_values,
+                         std::map<int, std::vector<T> >& out_values, mpl::true_)
+  {
+    int tag = sparse_exchange_tag(comm);
+    int rank = comm.rank();
+    out_values.clear();
+    std::vector<MPI_Request> sends;
+    sends.reserve(in_values.size());
+    for (typename std::map<int, std::vector<T> >::const_iterator it = in_values.begin();
+         it != in_values.end(); ++it) {
+      if (it->first == rank) {
+        out_values[rank] = it->second;
+      } else {
+        sends.push_back(MPI_REQUEST_NULL);
+        BOOST_MPI_CHECK_RESULT(MPI_Issend,
+                               (const_cast<T*>(c_data(it->second)), int(it->second.size()),
+                                get_mpi_datatype<T>(), it->first, tag, comm, &sends.back()));
+      }
+    }
+    sparse_array_receiver<T> receive(comm, out_values);
+    sparse_exchange(comm, tag, sends, receive);
+  }
+
+  // Arrays of values that do not have an associated MPI datatype are
+  // serialized as a whole.
+  template<typename T>
+  void
+  sparse_all_to_all_impl(const communicator& comm,
+                         const std::map<int, std::vector<T> >& in_values,
+                         std::map<int, std::vector<T> >& out_values, mpl::false_ is_mpi_type)
+  {
+    sparse_all_to_all_impl<std::vector<T> >(comm, in_values, out_values, is_mpi_type);
+  }
+} // end namespace detail
+
+template<typename T>
+void
+sparse_all_to_all(const communicator& comm, const std::map<int, T>& in_values,
+                  std::map<int, T>& out_values)
+{
+  detail::sparse_all_to_all_impl(comm, in_values, out_values, is_mpi_datatype<T>());
+}
+
+template<typename T>
+void
+sparse_all_to_all(const communicator& comm,
+                  const std::map<int, std::vector<T> >& in_values,
+                  std::map<int, std::vector<T> >& out_values)
+{
+  detail::sparse_all_to_all_impl(comm, in_values, out_values, is_mpi_datatype<T>());
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_VERSION >= 3
+
+#endif // BOOST_MPI_SPARSE_ALL_TO_ALL_HPP
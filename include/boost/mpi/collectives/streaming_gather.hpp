@@ -0,0 +1,89 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 1.1 -- Section 4.5. Gather
+#ifndef BOOST_MPI_STREAMING_GATHER_HPP
+#define BOOST_MPI_STREAMING_GATHER_HPP
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+template<typename T, typename Consumer>
+void
+streaming_gather(const communicator& comm, const T& in_value, Consumer consume,
+                 int root, int window)
+{
+  BOOST_ASSERT(comm.rank() == root);
+  BOOST_ASSERT(window > 0);
+  int nproc = comm.size();
+  int tag = environment::collectives_tag();
+  consume(root, in_value);
+
+  // Receive from the sources in rank order, at most window of them at
+  // a time. Each receive uses one of the values, which is handed to
+  // the consumer, then reused for the next source.
+  std::vector<T> values(std::min(window, std::max(nproc - 1, 1)));
+  std::vector<request> requests;
+  std::vector<int> slots;
+  std::vector<int> sources;
+  int next = 0;
+  for (int slot = 0; slot < int(values.size()); ++slot) {
+    next += next == root;
+    if (next == nproc) {
+      break;
+    }
+    requests.push_back(comm.irecv(next, tag, values[slot]));
+    slots.push_back(slot);
+    sources.push_back(next++);
+  }
+  while (!requests.empty()) {
+    std::pair<status, std::vector<request>::iterator> done
+      = wait_any(requests.begin(), requests.end());
+    std::size_t i = done.second - requests.begin();
+    const T& value = values[slots[i]];
+    consume(sources[i], value);
+    next += next == root;
+    if (next < nproc) {
+      requests[i] = comm.irecv(next, tag, values[slots[i]]);
+      sources[i] = next++;
+    } else {
+      std::swap(requests[i], requests.back());
+      std::swap(slots[i], slots.back());
+      std::swap(sources[i], sources.back());
+      requests.pop_back();
+      slots.pop_back();
+      sources.pop_back();
+    }
+  }
+}
+
+template<typename T, typename Consumer>
+void
+streaming_gather(const communicator& comm, const T& in_value, Consumer consume,
+                 int root)
+{
+  ::boost::mpi::streaming_gather(comm, in_value, consume, root, 16);
+}
+
+template<typename T>
+void
+streaming_gather(const communicator& comm, const T& in_value, int root)
+{
+  BOOST_ASSERT(comm.rank() != root);
+  comm.send(root, environment::collectives_tag(), in_value);
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_STREAMING_GATHER_HPP
@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 1.1 -- Section 4.6. Scatter
+#ifndef BOOST_MPI_STREAMING_SCATTER_HPP
+#define BOOST_MPI_STREAMING_SCATTER_HPP
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+template<typename T, typename Generator>
+void
+streaming_scatter(const communicator& comm, Generator generate, T& out_value,
+                  int root, int window)
+{
+  BOOST_ASSERT(comm.rank() == root);
+  BOOST_ASSERT(window > 0);
+  int nproc = comm.size();
+  int tag = environment::collectives_tag();
+
+  // Generate and send the values in rank order, with at most window
+  // sends at a time. Each send uses one of the values, which is
+  // reused for the next destination once it has completed.
+  std::vector<T> values(std::min(window, std::max(nproc - 1, 1)));
+  std::vector<request> requests;
+  std::vector<int> slots;
+  int next = 0;
+  for (int slot = 0; slot < int(values.size()); ++slot) {
+    next += next == root;
+    if (next == nproc) {
+      break;
+    }
+    values[slot] = generate(next);
+    requests.push_back(comm.isend(next++, tag, values[slot]));
+    slots.push_back(slot);
+  }
+  // Our own value while the first sends go.
+  out_value = generate(root);
+  while (!requests.empty()) {
+    std::vector<request>::iterator done
+      = wait_any(requests.begin(), requests.end()).second;
+    std::size_t i = done - requests.begin();
+    next += next == root;
+    if (next < nproc) {
+      values[slots[i]] = generate(next);
+      requests[i] = comm.isend(next++, tag, values[slots[i]]);
+    } else {
+      std::swap(requests[i], requests.back());
+      std::swap(slots[i], slots.back());
+      requests.pop_back();
+      slots.pop_back();
+    }
+  }
+}
+
+template<typename T, typename Generator>
+void
+streaming_scatter(const communicator& comm, Generator generate, T& out_value,
+                  int root)
+{
+  ::boost::mpi::streaming_scatter(comm, generate, out_value, root, 16);
+}
+
+template<typename T>
+void
+streaming_scatter(const communicator& comm, T& out_value, int root)
+{
+  BOOST_ASSERT(comm.rank() != root);
+  comm.recv(root, environment::collectives_tag(), out_value);
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_STREAMING_SCATTER_HPP
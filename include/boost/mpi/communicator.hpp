@@ -121,6 +121,14 @@ class graph_communicator;
  */
 class cartesian_communicator;
 
+/**
+ * INTERNAL ONLY
+ *
+ * Forward declaration of @c dist_graph_communicator needed for the "cast"
+ * from a communicator to a distributed graph communicator.
+ */
+class dist_graph_communicator;
+
 /**
  * @brief A communicator that permits communication and
  * synchronization among a set of processes.
@@ -816,6 +824,103 @@ class BOOST_MPI_DECL communicator
   communicator split(int color, int key) const;
   communicator split(int color) const;
 
+#if BOOST_MPI_VERSION >= 3
+  /**
+   * Split the communicator into disjoint communicators, each of which
+   * contains the processes that can share memory (usually the
+   * processes of a compute node), with @c MPI_Comm_split_type. This
+   * is a collective operation.
+   *
+   *   @param key A key value that will be used to determine the
+   *   ordering of processes in the resulting communicator. If
+   *   omitted, the rank of the processes in @p this will determine
+   *   the ordering of processes in the resulting group.
+   *
+   *   @returns A new communicator containing all of the processes in
+   *   @p this that share memory with the calling process.
+   */
+  communicator split_shared(int key) const;
+  communicator split_shared() const;
+
+  /**
+   * Retrieve the processes of this communicator that share memory
+   * with the calling process, ordered as in this communicator.
+   *
+   * The node communicator, and the node leaders communicator, are
+   * computed on the first call (which is then collective) and cached
+   * on the underlying MPI communicator, so that they are shared by
+   * all the copies of this communicator.
+   */
+  communicator node_communicator() const;
+
+  /**
+   * Retrieve the communicator made of the process of rank 0 of each
+   * @c node_communicator(), ordered as in this communicator. This is
+   * a null communicator on the other processes.
+   */
+  communicator node_leaders_communicator() const;
+
+  /**
+   * Make the collectives that serialize their values (@c broadcast,
+   * @c gather, @c gatherv, @c all_reduce and @c scan) run in two
+   * levels on this communicator, and on all of its copies: within
+   * each node, then among the node leaders, so that only one process
+   * per node exchanges data with the other nodes. Collectives on
+   * types with an associated MPI datatype are left to MPI.
+   *
+   * Non-commutative reductions and @c scan only use two levels when
+   * each node is a block of consecutive ranks. This is a collective
+   * operation.
+   *
+   *   @param enable Whether to use the two level algorithms.
+   */
+  void enable_hierarchical_collectives(bool enable = true) const;
+
+  /**
+   * Enable the two level collectives, using @p node instead of the
+   * processes that share memory as the first level. @p node must be
+   * the communicator returned by a @c split of this communicator,
+   * for instance by socket or by switch. This is a collective
+   * operation.
+   */
+  void enable_hierarchical_collectives(const communicator& node) const;
+
+  /**
+   * Determine whether the serialized collectives currently run in two
+   * levels on this communicator. This is only the case when
+   * they have been enabled and there are several nodes, one of them
+   * at least having several processes.
+   */
+  bool hierarchical_collectives_enabled() const;
+#endif
+
+  /**
+   * Make the collectives that serialize their values (@c broadcast,
+   * @c gather, @c gatherv, @c all_gather and @c all_gatherv) exchange
+   * their data in a single round on this communicator, and on all of
+   * its copies, when it is small enough.
+   *
+   * By default, these collectives first exchange the sizes of the
+   * archives, then the archives. With a slot of @p slot bytes, each
+   * process sends a slot holding the size of its archive followed by
+   * as much of it as fits. Only the archives that did not fit are
+   * completed in a second round, which halves the latency of
+   * the collectives on small values, at the cost of transmitting @p
+   * slot bytes per process. This is a collective operation: all the
+   * processes must use the same slot size.
+   *
+   *   @param slot The size of the slots, in bytes, including the size
+   *   of the archive (an @c int); 0 restores the default protocol.
+   */
+  void enable_speculative_collectives(int slot = 256) const;
+
+  /**
+   * The size of the slots set by @c enable_speculative_collectives, or
+   * 0 if the serialized collectives exchange the sizes of the
+   * archives first.
+   */
+  int speculative_collectives_slot() const;
+
   /**
    * Determine if the communicator is in fact an intercommunicator
    * and, if so, return that intercommunicator.
@@ -862,6 +967,27 @@ class BOOST_MPI_DECL communicator
    */
   bool has_cartesian_topology() const;
 
+#if BOOST_MPI_VERSION >= 3
+  /**
+   * Determine if the communicator has a distributed graph topology
+   * and, if so, return that @c dist_graph_communicator. Even though
+   * the communicators have different types, they refer to the same
+   * underlying communication space and can be used interchangeably
+   * for communication.
+   *
+   * @returns an @c optional containing the distributed graph
+   * communicator, if this communicator does in fact have a
+   * distributed graph topology. Otherwise, returns an empty @c
+   * optional.
+   */
+  optional<dist_graph_communicator> as_dist_graph_communicator() const;
+
+  /**
+   * Determines whether this communicator has a distributed Graph topology.
+   */
+  bool has_dist_graph_topology() const;
+#endif
+
   /** Abort all tasks in the group of this communicator.
    *
    *  Makes a "best attempt" to abort all of the tasks in the group of
@@ -0,0 +1,122 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file completion_queue.hpp
+ *
+ *  This header defines the @c completion_queue class, which runs the
+ *  continuations of requests as they complete.
+ */
+#ifndef BOOST_MPI_COMPLETION_QUEUE_HPP
+#define BOOST_MPI_COMPLETION_QUEUE_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/status.hpp>
+#include <boost/function.hpp>
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+/**
+ * @brief Requests whose continuations run when they complete.
+ *
+ * A @c completion_queue holds requests, each with the continuation
+ * attached by @c request::then, and runs these continuations, in the
+ * calling thread, when the program drains the queue with @c poll, @c
+ * wait_some or @c run. Each drain tests all the pending requests at
+ * once: the plain MPI requests with a single @c MPI_Testsome, and the
+ * others, such as receives of serialized data, with their own @c
+ * test(). An event loop can thus keep thousands of requests in flight
+ * without testing them one by one.
+ *
+ * Continuations may push new requests to the queue; those are tested
+ * by the next drain. An exception thrown by a continuation comes out
+ * of the drain that runs it; the continuations of the other completed
+ * requests are run by the next one.
+ */
+class BOOST_MPI_DECL completion_queue
+{
+public:
+  /**
+   * The type of the continuations.
+   */
+  typedef function<void (const status&)> continuation;
+
+  /**
+   * Build an empty queue.
+   */
+  completion_queue() {}
+
+  /**
+   * Add a request, with the continuation attached to it if any. A
+   * request that is not active, such as an empty one, is considered
+   * completed.
+   */
+  void push(const request& r);
+
+  /**
+   * Attach @p f to @p r and add it.
+   */
+  void push(request r, const continuation& f)
+  {
+    r.then(f);
+    push(r);
+  }
+
+  /**
+   * Test the pending requests once, and run the continuations of those
+   * that have completed.
+   *
+   *   @returns The number of requests that have completed.
+   */
+  std::size_t poll();
+
+  /**
+   * Wait until at least one of the requests has completed, and run
+   * the continuations of all those that have.
+   *
+   *   @returns The number of requests that have completed, which is 0
+   *   only if the queue is empty.
+   */
+  std::size_t wait_some();
+
+  /**
+   * Wait until all the requests have completed, including those
+   * pushed by the continuations, and run their continuations.
+   *
+   *   @returns The number of requests that have completed.
+   */
+  std::size_t run();
+
+  /**
+   * The number of requests whose continuations have not run.
+   */
+  std::size_t size() const { return m_pending.size() + m_completed.size(); }
+
+  /**
+   * Whether all the continuations have run.
+   */
+  bool empty() const { return size() == 0; }
+
+private:
+  // Move the requests that have completed to m_completed.
+  void collect();
+  // Run the continuations of the requests in m_completed on entry.
+  std::size_t run_completed();
+
+  std::vector<request>                    m_pending;
+  std::deque<std::pair<request, status> > m_completed;
+  // Reused by collect.
+  std::vector<request*>                   m_pointers;
+  std::vector<std::pair<int, status> >    m_done;
+};
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_COMPLETION_QUEUE_HPP
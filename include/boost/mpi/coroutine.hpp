@@ -0,0 +1,455 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file coroutine.hpp
+ *
+ *  This header lets C++20 coroutines wait for communications with @c
+ *  co_await. It provides the @c async_task coroutine type, the @c
+ *  async_scheduler that runs these coroutines and resumes them when
+ *  their communications complete, and awaitable sends, receives and
+ *  collectives. It is empty when the compiler does not support
+ *  coroutines, in which case @c BOOST_MPI_HAS_COROUTINES is not
+ *  defined.
+ */
+#ifndef BOOST_MPI_COROUTINE_HPP
+#define BOOST_MPI_COROUTINE_HPP
+
+#include <boost/mpi/config.hpp>
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__has_include)
+#  if __has_include(<coroutine>)
+#    define BOOST_MPI_HAS_COROUTINES 1
+#  endif
+#endif
+
+#if defined(BOOST_MPI_HAS_COROUTINES)
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/operations.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/status.hpp>
+#include <boost/mpi/detail/test_batch.hpp>
+#include <boost/assert.hpp>
+#include <boost/mpl/assert.hpp>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+class async_scheduler;
+
+/**
+ * @brief A coroutine run by an @c async_scheduler.
+ *
+ * A function that returns an @c async_task is a coroutine, which does
+ * not start until it is given to @c async_scheduler::spawn. It can
+ * then @c co_await requests, and the awaitable operations of this
+ * header: the scheduler resumes it when they complete.
+ */
+class async_task
+{
+public:
+  struct promise_type
+  {
+    async_task get_return_object()
+    {
+      return async_task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return std::suspend_always(); }
+    std::suspend_always final_suspend() noexcept { return std::suspend_always(); }
+    void return_void() {}
+    void unhandled_exception() { m_exception = std::current_exception(); }
+
+    std::exception_ptr m_exception;
+  };
+
+  typedef std::coroutine_handle<promise_type> handle_type;
+
+  async_task(async_task&& other) noexcept : m_handle(other.m_handle)
+  {
+    other.m_handle = handle_type();
+  }
+
+  ~async_task()
+  {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+private:
+  friend class async_scheduler;
+
+  explicit async_task(handle_type h) : m_handle(h) {}
+  async_task(const async_task&);
+  async_task& operator=(const async_task&);
+
+  handle_type m_handle;
+};
+
+/**
+ * @brief Run coroutines that wait for communications.
+ *
+ * The scheduler resumes its coroutines in turn, in the calling
+ * thread. When a coroutine waits for a request, it is set aside until
+ * that request has completed: each call to @c poll tests all the
+ * requests waited for at once, with a single @c MPI_Testsome for
+ * those that are plain MPI requests, then resumes the coroutines
+ * whose requests have completed. Thousands of exchanges can thus be
+ * in flight without a thread, or a callback, per exchange.
+ *
+ * An exception that escapes a coroutine ends it, and is thrown again
+ * by @c poll or @c run.
+ */
+class async_scheduler
+{
+public:
+  async_scheduler() {}
+
+  /**
+   * Destroy the coroutines that have not finished. None of them may be
+   * waiting for a request: MPI would then use their destroyed frames.
+   * Run the scheduler until they are done first, also after an
+   * exception came out of @c poll or @c run.
+   */
+  ~async_scheduler()
+  {
+    BOOST_ASSERT(m_waiting.empty());
+    for (std::size_t i = 0; i < m_tasks.size(); ++i) {
+      m_tasks[i].destroy();
+    }
+  }
+
+  /**
+   * Take charge of @p task, which starts at the next @c poll.
+   */
+  void spawn(async_task task)
+  {
+    async_task::handle_type h = task.m_handle;
+    task.m_handle = async_task::handle_type();
+    m_tasks.push_back(h);
+    m_ready.push_back(h);
+  }
+
+  /**
+   * Resume the coroutines that are ready, test the requests they wait
+   * for, and resume those whose requests have completed.
+   *
+   *   @returns Whether some coroutines have not finished.
+   */
+  bool poll()
+  {
+    scheduler_scope scope(this);
+    resume_ready();
+    if (!m_waiting.empty()) {
+      std::vector<request*> requests(m_waiting.size());
+      for (std::size_t i = 0; i < m_waiting.size(); ++i) {
+        requests[i] = m_waiting[i].m_request;
+      }
+      std::vector<std::pair<int, status> > completed;
+      detail::test_batch(&requests[0], int(requests.size()), completed);
+      if (!completed.empty()) {
+        std::vector<bool> done(m_waiting.size(), false);
+        for (std::size_t k = 0; k < completed.size(); ++k) {
+          waiting& w = m_waiting[completed[k].first];
+          *w.m_status = completed[k].second;
+          m_ready.push_back(w.m_handle);
+          done[completed[k].first] = true;
+        }
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < m_waiting.size(); ++i) {
+          if (!done[i]) {
+            m_waiting[kept++] = m_waiting[i];
+          }
+        }
+        m_waiting.resize(kept);
+        resume_ready();
+      }
+    }
+    return !m_tasks.empty();
+  }
+
+  /**
+   * Poll until all the coroutines have finished.
+   */
+  void run()
+  {
+    while (poll()) {
+    }
+  }
+
+  /**
+   * The number of coroutines that have not finished.
+   */
+  std::size_t size() const { return m_tasks.size(); }
+
+  /**
+   * The number of coroutines waiting for a request.
+   */
+  std::size_t waiting_count() const { return m_waiting.size(); }
+
+  /**
+   * The scheduler polling in the calling thread, if any.
+   */
+  static async_scheduler* current() { return current_slot(); }
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Resume @p h once @p r has completed, with its status in @p s.
+   */
+  void wait_for(request& r, status& s, async_task::handle_type h)
+  {
+    waiting w = { &r, &s, h };
+    m_waiting.push_back(w);
+  }
+
+private:
+  struct waiting
+  {
+    request*                m_request;
+    status*                 m_status;
+    async_task::handle_type m_handle;
+  };
+
+  static async_scheduler*& current_slot()
+  {
+    static thread_local async_scheduler* the_current = 0;
+    return the_current;
+  }
+
+  // Make a scheduler the current one while it polls.
+  struct scheduler_scope
+  {
+    explicit scheduler_scope(async_scheduler* s) : m_previous(current_slot())
+    {
+      current_slot() = s;
+    }
+    ~scheduler_scope() { current_slot() = m_previous; }
+    async_scheduler* m_previous;
+  };
+
+  void resume_ready()
+  {
+    while (!m_ready.empty()) {
+      async_task::handle_type h = m_ready.front();
+      m_ready.pop_front();
+      h.resume();
+      if (h.done()) {
+        std::exception_ptr e = h.promise().m_exception;
+        for (std::size_t i = 0; i < m_tasks.size(); ++i) {
+          if (m_tasks[i] == h) {
+            m_tasks[i] = m_tasks.back();
+            m_tasks.pop_back();
+            break;
+          }
+        }
+        h.destroy();
+        if (e) {
+          std::rethrow_exception(e);
+        }
+      }
+    }
+  }
+
+  std::vector<async_task::handle_type> m_tasks;
+  std::deque<async_task::handle_type>  m_ready;
+  std::vector<waiting>                 m_waiting;
+};
+
+/**
+ * @brief Wait for a request in a coroutine.
+ *
+ * The result of <tt>co_await</tt> is the @c status of the request.
+ */
+class request_awaiter
+{
+public:
+  explicit request_awaiter(const request& r) : m_request(r) {}
+
+  bool await_ready()
+  {
+    if (optional<status> stat = m_request.test()) {
+      m_status = *stat;
+      return true;
+    }
+    return false;
+  }
+
+  void await_suspend(async_task::handle_type h)
+  {
+    BOOST_ASSERT(async_scheduler::current());
+    async_scheduler::current()->wait_for(m_request, m_status, h);
+  }
+
+  status await_resume() { return m_status; }
+
+private:
+  request m_request;
+  status  m_status;
+};
+
+/**
+ * Let a coroutine run by an @c async_scheduler wait for a request:
+ * <tt>status s = co_await comm.irecv(src, tag, value);</tt>
+ */
+inline request_awaiter operator co_await(const request& r)
+{
+  return request_awaiter(r);
+}
+
+/**
+ * @brief Receive a value in a coroutine.
+ *
+ * The result of <tt>co_await</tt> is the value received.
+ */
+template<typename T>
+class recv_awaiter
+{
+public:
+  recv_awaiter(const communicator& comm, int source, int tag)
+    : m_comm(comm), m_source(source), m_tag(tag) {}
+
+  bool await_ready()
+  {
+    // The receive is only posted here, where the value has its final
+    // place.
+    m_request = m_comm.irecv(m_source, m_tag, m_value);
+    if (optional<status> stat = m_request.test()) {
+      m_status = *stat;
+      return true;
+    }
+    return false;
+  }
+
+  void await_suspend(async_task::handle_type h)
+  {
+    BOOST_ASSERT(async_scheduler::current());
+    async_scheduler::current()->wait_for(m_request, m_status, h);
+  }
+
+  T await_resume() { return std::move(m_value); }
+
+private:
+  communicator m_comm;
+  int          m_source;
+  int          m_tag;
+  T            m_value;
+  request      m_request;
+  status       m_status;
+};
+
+/**
+ * @brief Send a value in a coroutine.
+ *
+ * The value is copied in the awaiter, which lives until the send has
+ * completed. The result of <tt>co_await</tt> is the status of the
+ * send.
+ */
+template<typename T>
+class send_awaiter
+{
+public:
+  send_awaiter(const communicator& comm, int dest, int tag, const T& value)
+    : m_comm(comm), m_dest(dest), m_tag(tag), m_value(value) {}
+
+  bool await_ready()
+  {
+    m_request = m_comm.isend(m_dest, m_tag, m_value);
+    if (optional<status> stat = m_request.test()) {
+      m_status = *stat;
+      return true;
+    }
+    return false;
+  }
+
+  void await_suspend(async_task::handle_type h)
+  {
+    BOOST_ASSERT(async_scheduler::current());
+    async_scheduler::current()->wait_for(m_request, m_status, h);
+  }
+
+  status await_resume() { return m_status; }
+
+private:
+  communicator m_comm;
+  int          m_dest;
+  int          m_tag;
+  T            m_value;
+  request      m_request;
+  status       m_status;
+};
+
+/**
+ * Receive a value of type @c T from @p source: <tt>T value = co_await
+ * async_recv<T>(comm, source, tag);</tt>
+ */
+template<typename T>
+recv_awaiter<T> async_recv(const communicator& comm, int source, int tag)
+{
+  return recv_awaiter<T>(comm, source, tag);
+}
+
+/**
+ * Send a copy of @p value to @p dest: <tt>co_await async_send(comm,
+ * dest, tag, value);</tt>
+ */
+template<typename T>
+send_awaiter<T> async_send(const communicator& comm, int dest, int tag, const T& value)
+{
+  return send_awaiter<T>(comm, dest, tag, value);
+}
+
+#if BOOST_MPI_VERSION >= 3
+/**
+ * Wait in a coroutine until all the processes of @p comm have reached
+ * the barrier (@c MPI_Ibarrier). Like the other non-blocking
+ * collectives, it must be started in the same order on all the
+ * processes.
+ */
+inline request_awaiter async_barrier(const communicator& comm)
+{
+  return request_awaiter(request::make_ibarrier(comm));
+}
+
+/**
+ * Broadcast the @p n values at @p values from @p root (@c
+ * MPI_Ibcast). @c T must have an associated MPI datatype, and the
+ * values must stay in place until the broadcast has completed.
+ */
+template<typename T>
+request_awaiter async_broadcast(const communicator& comm, T* values, int n, int root)
+{
+  BOOST_MPL_ASSERT((is_mpi_datatype<T>));
+  return request_awaiter(request::make_ibroadcast(comm, values, n, root));
+}
+
+/**
+ * Combine the @p n values at @p in_values of all the processes into
+ * @p out_values (@c MPI_Iallreduce). @c T must have an associated MPI
+ * datatype, and @p op must be an MPI operation on it, such as @c
+ * std::plus<T>().
+ */
+template<typename T, typename Op>
+request_awaiter async_all_reduce(const communicator& comm, const T* in_values, int n,
+                                 T* out_values, Op)
+{
+  BOOST_MPL_ASSERT((is_mpi_datatype<T>));
+  BOOST_MPL_ASSERT((is_mpi_op<Op, T>));
+  return request_awaiter(request::make_iall_reduce(comm, in_values, out_values, n,
+                                                   is_mpi_op<Op, T>::op()));
+}
+#endif // BOOST_MPI_VERSION >= 3
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_HAS_COROUTINES
+
+#endif // BOOST_MPI_COROUTINE_HPP
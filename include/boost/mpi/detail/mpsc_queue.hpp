@@ -0,0 +1,90 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A lock-free queue with many producers and a single consumer.
+#ifndef BOOST_MPI_DETAIL_MPSC_QUEUE_HPP
+#define BOOST_MPI_DETAIL_MPSC_QUEUE_HPP
+
+#include <atomic>
+
+namespace boost { namespace mpi { namespace detail {
+
+/**
+ * The link of the elements of an @c mpsc_queue, which derive from it.
+ */
+struct mpsc_node
+{
+  mpsc_node() : m_next(0) {}
+  std::atomic<mpsc_node*> m_next;
+};
+
+/**
+ * An intrusive, unbounded queue of @c mpsc_node, that any thread can
+ * push to without a lock, and a single thread pops from (Vyukov's
+ * algorithm). Pushing is a single atomic exchange; the queue does not
+ * own its elements.
+ */
+class mpsc_queue
+{
+public:
+  mpsc_queue() : m_head(&m_stub), m_tail(&m_stub) {}
+
+  /**
+   * Add @p n at the end of the queue. Any thread may call this.
+   */
+  void push(mpsc_node* n)
+  {
+    n->m_next.store(0, std::memory_order_relaxed);
+    mpsc_node* previous = m_head.exchange(n, std::memory_order_acq_rel);
+    previous->m_next.store(n, std::memory_order_release);
+  }
+
+  /**
+   * Take the first element of the queue, or return 0 if there is none
+   * yet. Only the consumer thread may call this. An element whose
+   * push is still in progress in another thread may not be seen.
+   */
+  mpsc_node* pop()
+  {
+    mpsc_node* tail = m_tail;
+    mpsc_node* next = tail->m_next.load(std::memory_order_acquire);
+    if (tail == &m_stub) {
+      if (!next) {
+        return 0;
+      }
+      m_tail = next;
+      tail = next;
+      next = next->m_next.load(std::memory_order_acquire);
+    }
+    if (next) {
+      m_tail = next;
+      return tail;
+    }
+    if (tail != m_head.load(std::memory_order_acquire)) {
+      return 0;
+    }
+    // tail is the last element: put the stub behind it to take it.
+    push(&m_stub);
+    next = tail->m_next.load(std::memory_order_acquire);
+    if (next) {
+      m_tail = next;
+      return tail;
+    }
+    return 0;
+  }
+
+private:
+  mpsc_queue(const mpsc_queue&);
+  mpsc_queue& operator=(const mpsc_queue&);
+
+  std::atomic<mpsc_node*> m_head;
+  mpsc_node*              m_tail;
+  mpsc_node               m_stub;
+};
+
+} } } // end namespace boost::mpi::detail
+
+#endif // BOOST_MPI_DETAIL_MPSC_QUEUE_HPP
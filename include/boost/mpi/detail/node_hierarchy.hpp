@@ -0,0 +1,133 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Two level (intra-node, then inter-node) support for the serialized
+// collectives.
+#ifndef BOOST_MPI_DETAIL_NODE_HIERARCHY_HPP
+#define BOOST_MPI_DETAIL_NODE_HIERARCHY_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/allocator.hpp>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+#if BOOST_MPI_VERSION >= 3
+
+namespace boost { namespace mpi { namespace detail {
+
+/**
+ * INTERNAL ONLY
+ *
+ * The decomposition of a communicator into nodes, as cached on the
+ * underlying MPI communicator by @c communicator::node_communicator
+ * or @c communicator::enable_hierarchical_collectives. Node @c k is
+ * the node whose leader (its process of rank 0) has rank @c k in the
+ * leaders communicator.
+ */
+struct node_hierarchy
+{
+  /// The processes of the node of the calling process.
+  communicator node;
+  /// The node leaders, null on the other processes.
+  communicator leaders;
+  /// The rank of the calling process in the hierarchical communicator.
+  int rank;
+  /// For each process, the index of its node.
+  std::vector<int> node_of;
+  /// For each process, its rank in its node.
+  std::vector<int> node_rank_of;
+  /// For each node, its number of processes.
+  std::vector<int> node_sizes;
+  /// The processes, node after node, each node in node rank order.
+  std::vector<int> order;
+  /// Whether each node is a block of consecutive ranks, in node
+  /// order, so that ordered (prefix, non-commutative) reductions can
+  /// be performed node by node.
+  bool contiguous;
+  /// Whether the nodes are made of the processes that share memory.
+  bool shared_memory;
+  /// Whether the serialized collectives use this hierarchy.
+  bool enabled;
+  /// When the nodes are not those of shared memory, the shared memory
+  /// hierarchy, once it has been computed.
+  shared_ptr<node_hierarchy> shared_memory_nodes;
+
+  /// Whether two levels are worth the trouble: there must be several
+  /// nodes, one of them at least with several processes.
+  bool worthwhile() const
+  {
+    return node_sizes.size() > 1 && node_sizes.size() < node_of.size();
+  }
+};
+
+/**
+ * INTERNAL ONLY
+ *
+ * Retrieve the node hierarchy cached on @p comm, building it (a
+ * collective operation) if needed. If @p node is not null, it
+ * replaces the shared memory node discovery and any cached hierarchy.
+ */
+BOOST_MPI_DECL node_hierarchy&
+get_node_hierarchy(const communicator& comm, const communicator* node = 0);
+
+/**
+ * INTERNAL ONLY
+ *
+ * Retrieve the decomposition of @p comm into shared memory nodes,
+ * from the cache if it holds one, building and caching it otherwise
+ * (a collective operation). It is cached next to a custom hierarchy.
+ */
+BOOST_MPI_DECL node_hierarchy
+shared_memory_hierarchy(const communicator& comm);
+
+/**
+ * INTERNAL ONLY
+ *
+ * The node hierarchy the serialized collectives should use on @p
+ * comm, or null. This is a local operation.
+ */
+BOOST_MPI_DECL const node_hierarchy*
+active_node_hierarchy(const communicator& comm);
+
+/**
+ * INTERNAL ONLY
+ *
+ * Broadcast @p buffer from @p root to all the processes of the
+ * hierarchical communicator: within the node of @p root, then among
+ * the node leaders, then within the other nodes.
+ */
+BOOST_MPI_DECL void
+hierarchical_broadcast(const node_hierarchy& h, int root,
+                       std::vector<char, allocator<char> >& buffer);
+
+/**
+ * INTERNAL ONLY
+ *
+ * Gather the @p size bytes at @p data of every process to @p root:
+ * within each node, then among the node leaders. On @p root, the
+ * bytes of process @c p are stored at @c buffer[offsets[p]] and are
+ * @c sizes[p] long.
+ */
+BOOST_MPI_DECL void
+hierarchical_gather(const node_hierarchy& h, int root,
+                    const void* data, int size,
+                    std::vector<char, allocator<char> >& buffer,
+                    std::vector<int>& sizes, std::vector<int>& offsets);
+
+/**
+ * INTERNAL ONLY
+ *
+ * Drop the hierarchies cached on the predefined communicators. Called
+ * by the environment before finalizing MPI.
+ */
+BOOST_MPI_DECL void release_node_hierarchies();
+
+} } } // end namespace boost::mpi::detail
+
+#endif // BOOST_MPI_VERSION >= 3
+
+#endif // BOOST_MPI_DETAIL_NODE_HIERARCHY_HPP
@@ -0,0 +1,73 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MPI_DETAIL_PACKED_BATCH_HPP
+#define BOOST_MPI_DETAIL_PACKED_BATCH_HPP
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <cstddef>
+
+namespace boost { namespace mpi { namespace detail {
+
+/**
+ * Items packed one after the other, behind their number, to be sent
+ * to one destination as a single message. The receiver reads the
+ * number, then the items, from a @c packed_iarchive.
+ */
+class packed_batch
+{
+public:
+  packed_batch() : m_count(0) {}
+
+  /**
+   * The archive to pack one more item into.
+   */
+  packed_oarchive& add(const communicator& comm)
+  {
+    if (!m_archive) {
+      // Make room for the number of items, written by post().
+      m_buffer.reset(new packed_oarchive::buffer_type());
+      m_archive.reset(new packed_oarchive(comm, *m_buffer));
+      *m_archive << m_count;
+    }
+    ++m_count;
+    return *m_archive;
+  }
+
+  int count() const { return m_count; }
+
+  std::size_t bytes() const { return m_buffer ? m_buffer->size() : 0; }
+
+  /**
+   * Send the items, and start a new batch.
+   */
+  request post(const communicator& comm, int dest, int tag)
+  {
+    // An int always packs to the same size: overwrite the zero.
+    packed_oarchive::buffer_type head;
+    packed_oarchive(comm, head) << m_count;
+    std::copy(head.begin(), head.end(), m_buffer->begin());
+    request r = comm.isend(dest, tag, *m_archive);
+    r.preserve(m_buffer);
+    m_archive.reset();
+    m_buffer.reset();
+    m_count = 0;
+    return r;
+  }
+
+private:
+  shared_ptr<packed_oarchive::buffer_type> m_buffer;
+  shared_ptr<packed_oarchive> m_archive;
+  int m_count;
+};
+
+} } } // end namespace boost::mpi::detail
+
+#endif // BOOST_MPI_DETAIL_PACKED_BATCH_HPP
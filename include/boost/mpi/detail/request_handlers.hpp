@@ -183,7 +183,7 @@ protected:
     return stat;
   }
   
-  communicator const& m_comm;
+  communicator m_comm;
   int m_source;
   int m_tag;
 };
@@ -506,6 +506,7 @@ public:
   
   bool active() const;
   optional<MPI_Request&> trivial();
+  bool progresses() const { return true; }
 
 private:
   friend class request;
@@ -521,6 +522,8 @@ class request::dynamic_handler : public request::handler {
   
   bool active() const;
   optional<MPI_Request&> trivial();
+  // Both messages are posted at once.
+  bool progresses() const { return true; }
 
 private:
   friend class request;
@@ -530,18 +533,18 @@ private:
 template<typename T> 
 request request::make_serialized(communicator const& comm, int source, int tag, T& value) {
 #if defined(BOOST_MPI_USE_IMPROBE)
-  return request(new probe_handler<detail::serialized_data<T> >(comm, source, tag, value));
+  return progressed(new probe_handler<detail::serialized_data<T> >(comm, source, tag, value));
 #else
-  return request(new legacy_serialized_handler<T>(comm, source, tag, value));
+  return progressed(new legacy_serialized_handler<T>(comm, source, tag, value));
 #endif
 }
 
 template<typename T>
 request request::make_serialized_array(communicator const& comm, int source, int tag, T* values, int n) {
 #if defined(BOOST_MPI_USE_IMPROBE)
-  return request(new probe_handler<detail::serialized_array_data<T> >(comm, source, tag, values, n));
+  return progressed(new probe_handler<detail::serialized_array_data<T> >(comm, source, tag, values, n));
 #else
-  return request(new legacy_serialized_array_handler<T>(comm, source, tag, values, n));
+  return progressed(new legacy_serialized_array_handler<T>(comm, source, tag, values, n));
 #endif
 }
 
@@ -549,9 +552,9 @@ template<typename T, class A>
 request request::make_dynamic_primitive_array_recv(communicator const& comm, int source, int tag, 
                                                    std::vector<T,A>& values) {
 #if defined(BOOST_MPI_USE_IMPROBE)
-  return request(new probe_handler<detail::dynamic_primitive_array_data<std::vector<T,A> > >(comm,source,tag,values));
+  return progressed(new probe_handler<detail::dynamic_primitive_array_data<std::vector<T,A> > >(comm,source,tag,values));
 #else
-  return request(new legacy_dynamic_primitive_array_handler<T,A>(comm, source, tag, values));
+  return progressed(new legacy_dynamic_primitive_array_handler<T,A>(comm, source, tag, values));
 #endif
 }
 
@@ -589,6 +592,51 @@ request::make_trivial_recv(communicator const& comm, int dest, int tag, T& value
   return make_trivial_recv(comm, dest, tag, &value, 1);
 }
 
+#if BOOST_MPI_VERSION >= 3
+template<typename T>
+request
+request::make_trivial_put(MPI_Win win, int target, MPI_Aint disp, T const* values, int n) {
+  trivial_handler* handler = new trivial_handler;
+  BOOST_MPI_CHECK_RESULT(MPI_Rput,
+                         (const_cast<T*>(values), n, get_mpi_datatype<T>(),
+                          target, disp, n, get_mpi_datatype<T>(),
+                          win, &handler->m_request));
+  return request(handler);
+}
+
+template<typename T>
+request
+request::make_trivial_get(MPI_Win win, int target, MPI_Aint disp, T* values, int n) {
+  trivial_handler* handler = new trivial_handler;
+  BOOST_MPI_CHECK_RESULT(MPI_Rget,
+                         (values, n, get_mpi_datatype<T>(),
+                          target, disp, n, get_mpi_datatype<T>(),
+                          win, &handler->m_request));
+  return request(handler);
+}
+
+template<typename T>
+request
+request::make_ibroadcast(communicator const& comm, T* values, int n, int root) {
+  trivial_handler* handler = new trivial_handler;
+  BOOST_MPI_CHECK_RESULT(MPI_Ibcast,
+                         (values, n, get_mpi_datatype<T>(), root, comm,
+                          &handler->m_request));
+  return request(handler);
+}
+
+template<typename T>
+request
+request::make_iall_reduce(communicator const& comm, T const* in_values, T* out_values,
+                          int n, MPI_Op op) {
+  trivial_handler* handler = new trivial_handler;
+  BOOST_MPI_CHECK_RESULT(MPI_Iallreduce,
+                         (const_cast<T*>(in_values), out_values, n, get_mpi_datatype<T>(),
+                          op, comm, &handler->m_request));
+  return request(handler);
+}
+#endif
+
 template<typename T, class A>
 request request::make_dynamic_primitive_array_send(communicator const& comm, int dest, int tag, 
                                                    std::vector<T,A> const& values) {
@@ -0,0 +1,84 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Single round (speculative slot) support for the serialized
+// collectives.
+#ifndef BOOST_MPI_DETAIL_SPECULATIVE_COLLECTIVES_HPP
+#define BOOST_MPI_DETAIL_SPECULATIVE_COLLECTIVES_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/allocator.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace mpi { namespace detail {
+
+/**
+ * INTERNAL ONLY
+ *
+ * The size of the slot the serialized collectives exchange in their
+ * first round on @p comm, as set by @c
+ * communicator::enable_speculative_collectives, or 0 if they exchange
+ * the archive sizes first. This is a local operation.
+ */
+BOOST_MPI_DECL int
+speculative_slot(const communicator& comm);
+
+/**
+ * INTERNAL ONLY
+ *
+ * Gather the @p size bytes at @p data of every process to @p root,
+ * in slots of @p slot bytes that start with the size of the data and
+ * hold as much of it as fits. Only the processes whose data did not
+ * fit send the rest, in a second message. On @p root, the bytes of
+ * process @c p are stored at @c buffer[offsets[p]] and are @c
+ * sizes[p] long.
+ */
+BOOST_MPI_DECL void
+speculative_gather(const communicator& comm, int root, int slot,
+                   const void* data, int size,
+                   std::vector<char, allocator<char> >& buffer,
+                   std::vector<int>& sizes, std::vector<int>& offsets);
+
+/**
+ * INTERNAL ONLY
+ *
+ * Same as @c speculative_gather, with the result on every process. A
+ * second collective round only takes place when the data of some
+ * process did not fit in its slot.
+ */
+BOOST_MPI_DECL void
+speculative_all_gather(const communicator& comm, int slot,
+                       const void* data, int size,
+                       std::vector<char, allocator<char> >& buffer,
+                       std::vector<int>& sizes, std::vector<int>& offsets);
+
+/**
+ * INTERNAL ONLY
+ *
+ * Broadcast @p buffer from @p root in a slot of @p slot bytes that
+ * starts with its size and holds as much of it as fits. A second
+ * broadcast, of the rest, only takes place if it did not fit.
+ */
+BOOST_MPI_DECL void
+speculative_broadcast(const communicator& comm, int root, int slot,
+                      std::vector<char, allocator<char> >& buffer);
+
+/**
+ * INTERNAL ONLY
+ *
+ * The slot that holds an archive of @p size_hint bytes.
+ */
+inline int
+hinted_slot(std::size_t size_hint)
+{
+  return int(sizeof(int) + size_hint);
+}
+
+} } } // end namespace boost::mpi::detail
+
+#endif // BOOST_MPI_DETAIL_SPECULATIVE_COLLECTIVES_HPP
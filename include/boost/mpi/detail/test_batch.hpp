@@ -0,0 +1,30 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Test many requests with a single MPI_Testsome.
+#ifndef BOOST_MPI_DETAIL_TEST_BATCH_HPP
+#define BOOST_MPI_DETAIL_TEST_BATCH_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/status.hpp>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace mpi { namespace detail {
+
+/**
+ * Test the @p n active requests at @p requests: the trivial ones with
+ * a single @c MPI_Testsome, the others with their own @c test(). The
+ * position and status of those that have completed are appended to
+ * @p completed. Inactive requests are skipped.
+ */
+BOOST_MPI_DECL void
+test_batch(request* const* requests, int n, std::vector<std::pair<int, status> >& completed);
+
+} } } // end namespace boost::mpi::detail
+
+#endif // BOOST_MPI_DETAIL_TEST_BATCH_HPP
@@ -0,0 +1,478 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file dist_graph_communicator.hpp
+ *
+ *  This header defines facilities to support MPI communicators with
+ *  distributed graph topologies (MPI 2.2, @c MPI_Dist_graph_create_adjacent).
+ *  Unlike @c graph_communicator, where every process must provide the
+ *  whole process graph, each process only describes its own incoming
+ *  and outgoing neighbors, which keeps the memory footprint and the
+ *  setup cost proportional to the local degree. The local adjacency
+ *  of the calling process can be viewed as a graph by the Boost Graph
+ *  Library.
+ */
+#ifndef BOOST_MPI_DIST_GRAPH_COMMUNICATOR_HPP
+#define BOOST_MPI_DIST_GRAPH_COMMUNICATOR_HPP
+
+#include <boost/mpi/communicator.hpp>
+
+#if BOOST_MPI_VERSION >= 3
+
+#include <vector>
+#include <utility>
+
+// Headers required to implement graph topologies
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/assert.hpp>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  /**
+   * INTERNAL ONLY
+   *
+   * The neighborhood of the calling process in a distributed graph
+   * topology, as returned by @c MPI_Dist_graph_neighbors. It is
+   * fetched once and shared by all the copies of a communicator.
+   */
+  struct dist_graph_adjacency
+  {
+    bool             weighted;
+    std::vector<int> sources;
+    std::vector<int> source_weights;
+    std::vector<int> destinations;
+    std::vector<int> destination_weights;
+  };
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Retrieve the number of incoming and outgoing neighbors of the
+   * calling process in any communicator with a process topology
+   * (cartesian, graph or distributed graph). This is the number of
+   * blocks exchanged by the neighborhood collectives.
+   */
+  BOOST_MPI_DECL void
+  neighbor_counts(communicator const& comm, int& indegree, int& outdegree);
+}
+
+/**
+ * @brief An MPI communicator with a distributed graph topology.
+ *
+ * A @c dist_graph_communicator is a communicator whose topology is
+ * expressed as a directed graph, in which each process only knows
+ * about its own incoming (source) and outgoing (destination)
+ * neighbors. Edges can optionally carry integer weights, which MPI
+ * may use to optimize the placement of processes when reordering is
+ * permitted.
+ *
+ * Distributed graph communicators have the same functionality as
+ * (intra)communicators, support the neighborhood collectives (@c
+ * neighbor_all_gather, @c neighbor_all_to_all) and can be viewed by
+ * the Boost Graph Library as a Bidirectional, Adjacency and Vertex
+ * List Graph. Since the global edge list is never assembled, the
+ * incidence and adjacency functions only accept the vertex that
+ * corresponds to the rank of the calling process.
+ */
+class BOOST_MPI_DECL dist_graph_communicator : public communicator
+{
+  friend class communicator;
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Construct a distributed graph communicator given a shared pointer
+   * to the underlying MPI_Comm. This operation is used for "casting"
+   * from a communicator to a distributed graph communicator.
+   */
+  explicit dist_graph_communicator(const shared_ptr<MPI_Comm>& comm_ptr);
+
+public:
+  /**
+   * Build a new Boost.MPI distributed graph communicator based on the
+   * MPI communicator @p comm with distributed graph topology.
+   *
+   * @p comm may be any valid MPI communicator. If @p comm is
+   * MPI_COMM_NULL, an empty communicator (that cannot be used for
+   * communication) is created and the @p kind parameter is
+   * ignored. Otherwise, the @p kind parameter determines how the
+   * Boost.MPI communicator will be related to @p comm, as described
+   * for the @c communicator constructor.
+   */
+  dist_graph_communicator(const MPI_Comm& comm, comm_create_kind kind);
+
+  /**
+   *  Create a new communicator whose topology is a distributed graph,
+   *  with unweighted edges. This is a collective operation, but each
+   *  process only describes its own neighborhood.
+   *
+   *  @param comm The communicator that the new, distributed graph
+   *  communicator will be based on.
+   *
+   *  @param sources The ranks, in @p comm, of the processes that have
+   *  an edge towards the calling process.
+   *
+   *  @param destinations The ranks, in @p comm, of the processes the
+   *  calling process has an edge towards.
+   *
+   *  @param reorder Whether MPI is permitted to re-order the process
+   *  ranks within the returned communicator, to better optimize
+   *  communication. If false, the ranks of each process in the
+   *  returned process will match precisely the rank of that process
+   *  within the original communicator.
+   */
+  dist_graph_communicator(const communicator& comm,
+                          const std::vector<int>& sources,
+                          const std::vector<int>& destinations,
+                          bool reorder = false);
+
+  /**
+   *  Create a new communicator whose topology is a distributed graph,
+   *  with weighted edges.
+   *
+   *  @param comm The communicator that the new, distributed graph
+   *  communicator will be based on.
+   *
+   *  @param sources The ranks of the processes that have an edge
+   *  towards the calling process.
+   *
+   *  @param source_weights The weights of the incoming edges. Must
+   *  have the same size as @p sources.
+   *
+   *  @param destinations The ranks of the processes the calling
+   *  process has an edge towards.
+   *
+   *  @param destination_weights The weights of the outgoing
+   *  edges. Must have the same size as @p destinations.
+   *
+   *  @param reorder Whether MPI is permitted to re-order the process
+   *  ranks within the returned communicator.
+   */
+  dist_graph_communicator(const communicator& comm,
+                          const std::vector<int>& sources,
+                          const std::vector<int>& source_weights,
+                          const std::vector<int>& destinations,
+                          const std::vector<int>& destination_weights,
+                          bool reorder = false);
+
+  /**
+   * The number of processes that have an edge towards the calling
+   * process.
+   */
+  int in_degree() const { return m_adjacency->sources.size(); }
+
+  /**
+   * The number of processes the calling process has an edge towards.
+   */
+  int out_degree() const { return m_adjacency->destinations.size(); }
+
+  /**
+   * Whether the edges of the topology carry weights.
+   */
+  bool is_weighted() const { return m_adjacency->weighted; }
+
+  /**
+   * The ranks of the processes that have an edge towards the calling
+   * process, in the order used by the neighborhood collectives.
+   */
+  const std::vector<int>& sources() const { return m_adjacency->sources; }
+
+  /**
+   * The weights of the incoming edges, empty if the topology is not
+   * weighted.
+   */
+  const std::vector<int>& source_weights() const { return m_adjacency->source_weights; }
+
+  /**
+   * The ranks of the processes the calling process has an edge
+   * towards, in the order used by the neighborhood collectives.
+   */
+  const std::vector<int>& destinations() const { return m_adjacency->destinations; }
+
+  /**
+   * The weights of the outgoing edges, empty if the topology is not
+   * weighted.
+   */
+  const std::vector<int>& destination_weights() const { return m_adjacency->destination_weights; }
+
+private:
+  /**
+   * INTERNAL ONLY
+   *
+   * Used by the constructors to create the new communicator with a
+   * distributed graph topology.
+   */
+  void
+  setup_dist_graph(const communicator& comm,
+                   const std::vector<int>& sources, const int* source_weights,
+                   const std::vector<int>& destinations, const int* destination_weights,
+                   bool reorder);
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Retrieve the neighborhood of the calling process from MPI.
+   */
+  void fetch_adjacency();
+
+  shared_ptr<const detail::dist_graph_adjacency> m_adjacency;
+};
+
+/****************************************************************************
+ *  Communicator with Distributed Graph Topology as BGL Graph               *
+ ****************************************************************************/
+namespace detail {
+  /**
+   *  INTERNAL ONLY
+   *
+   *  The iterator used to access the incoming or outgoing edges of the
+   *  calling process in a distributed graph topology.
+   */
+  class dist_graph_edge_iterator
+    : public iterator_facade<dist_graph_edge_iterator,
+                             std::pair<int, int>,
+                             random_access_traversal_tag,
+                             std::pair<int, int>,
+                             int>
+  {
+  public:
+    dist_graph_edge_iterator() : vertex(-1), neighbor(0), outgoing(true) { }
+
+    dist_graph_edge_iterator(int vertex, const int* neighbor, bool outgoing)
+      : vertex(vertex), neighbor(neighbor), outgoing(outgoing) { }
+
+  protected:
+    friend class boost::iterator_core_access;
+
+    std::pair<int, int> dereference() const
+    {
+      return (outgoing
+              ? std::make_pair(vertex, *neighbor)
+              : std::make_pair(*neighbor, vertex));
+    }
+
+    bool equal(const dist_graph_edge_iterator& other) const
+    {
+      return neighbor == other.neighbor;
+    }
+
+    void increment() { ++neighbor; }
+
+    void decrement() { --neighbor; }
+
+    void advance(int n) { neighbor += n; }
+
+    int distance_to(const dist_graph_edge_iterator& other) const
+    {
+      return other.neighbor - neighbor;
+    }
+
+    int        vertex;
+    const int* neighbor;
+    bool       outgoing;
+  };
+} // end namespace detail
+
+// Incidence Graph requirements
+
+/**
+ * @brief Returns the source vertex from an edge in the distributed
+ * graph topology of a communicator.
+ */
+inline int source(const std::pair<int, int>& edge, const dist_graph_communicator&)
+{
+  return edge.first;
+}
+
+/**
+ * @brief Returns the target vertex from an edge in the distributed
+ * graph topology of a communicator.
+ */
+inline int target(const std::pair<int, int>& edge, const dist_graph_communicator&)
+{
+  return edge.second;
+}
+
+/**
+ * @brief Returns an iterator range containing all of the edges
+ * outgoing from the calling process in a distributed graph topology.
+ *
+ * @p vertex must be the rank of the calling process.
+ */
+BOOST_MPI_DECL std::pair<detail::dist_graph_edge_iterator, detail::dist_graph_edge_iterator>
+out_edges(int vertex, const dist_graph_communicator& comm);
+
+/**
+ * @brief Returns the out-degree of the calling process in a
+ * distributed graph topology.
+ *
+ * @p vertex must be the rank of the calling process.
+ */
+BOOST_MPI_DECL int out_degree(int vertex, const dist_graph_communicator& comm);
+
+// Bidirectional Graph requirements
+
+/**
+ * @brief Returns an iterator range containing all of the edges
+ * incoming to the calling process in a distributed graph topology.
+ *
+ * @p vertex must be the rank of the calling process.
+ */
+BOOST_MPI_DECL std::pair<detail::dist_graph_edge_iterator, detail::dist_graph_edge_iterator>
+in_edges(int vertex, const dist_graph_communicator& comm);
+
+/**
+ * @brief Returns the in-degree of the calling process in a
+ * distributed graph topology.
+ *
+ * @p vertex must be the rank of the calling process.
+ */
+BOOST_MPI_DECL int in_degree(int vertex, const dist_graph_communicator& comm);
+
+/**
+ * @brief Returns the number of incoming and outgoing edges of the
+ * calling process in a distributed graph topology.
+ *
+ * @p vertex must be the rank of the calling process.
+ */
+BOOST_MPI_DECL int degree(int vertex, const dist_graph_communicator& comm);
+
+// Adjacency Graph requirements
+
+/**
+ * @brief Returns an iterator range containing the destinations of
+ * the calling process in the communicator's distributed graph topology.
+ *
+ * @p vertex must be the rank of the calling process.
+ */
+BOOST_MPI_DECL std::pair<std::vector<int>::const_iterator, std::vector<int>::const_iterator>
+adjacent_vertices(int vertex, const dist_graph_communicator& comm);
+
+// Vertex List Graph requirements
+
+/**
+ * @brief Returns an iterator range that contains all of the vertices
+ * with the communicator's distributed graph topology, i.e., all of
+ * the process ranks in the communicator.
+ */
+inline std::pair<counting_iterator<int>, counting_iterator<int> >
+vertices(const dist_graph_communicator& comm)
+{
+  return std::make_pair(counting_iterator<int>(0),
+                        counting_iterator<int>(comm.size()));
+}
+
+/**
+ *  @brief Returns the number of vertices within the distributed graph
+ *  topology of the communicator, i.e., the number of processes in the
+ *  communicator.
+ */
+inline int num_vertices(const dist_graph_communicator& comm) { return comm.size(); }
+
+// Property Graph requirements
+
+/**
+ *  @brief Returns a property map that maps from vertices in a
+ *  communicator's distributed graph topology to their index values.
+ *
+ *  Since the vertices are ranks in the communicator, the returned
+ *  property map is the identity property map.
+ */
+inline identity_property_map get(vertex_index_t, const dist_graph_communicator&)
+{
+  return identity_property_map();
+}
+
+/**
+ * @brief Returns the index of a vertex in the communicator's
+ * distributed graph topology.
+ *
+ * Since the vertices are ranks in the communicator, this is the
+ *  identity function.
+ */
+inline int get(vertex_index_t, const dist_graph_communicator&, int vertex)
+{
+  return vertex;
+}
+
+} } // end namespace boost::mpi
+
+namespace boost {
+
+/**
+ * @brief Traits structure that allows a communicator with distributed
+ * graph topology to be viewed as a graph by the Boost Graph Library.
+ *
+ * An MPI communicator with distributed graph topology meets the
+ * requirements of the Graph, Incidence Graph, Bidirectional Graph,
+ * Adjacency Graph and Vertex List Graph concepts from the Boost Graph
+ * Library, restricted to the edges of the calling process.
+ */
+template<>
+struct graph_traits<mpi::dist_graph_communicator> {
+  // Graph concept requirements
+  typedef int                        vertex_descriptor;
+  typedef std::pair<int, int>        edge_descriptor;
+  typedef bidirectional_tag          directed_category;
+  typedef allow_parallel_edge_tag    edge_parallel_category;
+
+  /**
+   * INTERNAL ONLY
+   */
+  struct traversal_category
+    : bidirectional_graph_tag,
+      adjacency_graph_tag,
+      vertex_list_graph_tag
+  {
+  };
+
+  /**
+   * @brief Returns a vertex descriptor that can never refer to any
+   * valid vertex.
+   */
+  static vertex_descriptor null_vertex() { return -1; }
+
+  // Incidence Graph requirements
+  typedef mpi::detail::dist_graph_edge_iterator out_edge_iterator;
+  typedef int degree_size_type;
+
+  // Bidirectional Graph requirements
+  typedef mpi::detail::dist_graph_edge_iterator in_edge_iterator;
+
+  // Adjacency Graph requirements
+  typedef std::vector<int>::const_iterator adjacency_iterator;
+
+  // Vertex List Graph requirements
+  typedef counting_iterator<int> vertex_iterator;
+  typedef int                    vertices_size_type;
+
+  // Edge List Graph types, required by graph_traits but not supported
+  typedef void edge_iterator;
+  typedef int  edges_size_type;
+};
+
+// Property Graph requirements
+
+/**
+ * INTERNAL ONLY
+ */
+template<>
+struct property_map<mpi::dist_graph_communicator, vertex_index_t>
+{
+  typedef identity_property_map type;
+  typedef identity_property_map const_type;
+};
+
+} // end namespace boost
+
+#endif // BOOST_MPI_VERSION >= 3
+
+#endif // BOOST_MPI_DIST_GRAPH_COMMUNICATOR_HPP
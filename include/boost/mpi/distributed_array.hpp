@@ -0,0 +1,151 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file distributed_array.hpp
+ *
+ *  This header defines the @c distributed_array_layout class, which
+ *  describes how an N-dimensional array stored in a file is split
+ *  among processes, for the collective reads and writes of @c file.
+ */
+#ifndef BOOST_MPI_DISTRIBUTED_ARRAY_HPP
+#define BOOST_MPI_DISTRIBUTED_ARRAY_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/cartesian_communicator.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+/**
+ * @brief How an array is split along one dimension of the process
+ * grid.
+ */
+enum distribution_kind {
+  /** Consecutive blocks, one per process. */
+  distribute_block,
+  /** Blocks dealt to the processes in turn. */
+  distribute_cyclic,
+  /** Not split: the grid must have a single process along it. */
+  distribute_none
+};
+
+/**
+ * @brief Specify the size and distribution of an array along a
+ * single dimension.
+ *
+ * POD lightweight object, the array counterpart of @c
+ * cartesian_dimension.
+ */
+struct array_dimension {
+  /** The number of elements along this dimension. */
+  int size;
+  /** How they are split among the processes. */
+  distribution_kind distribution;
+  /** The size of the blocks; 0 selects the default, which is the
+   *  size divided by the number of processes (rounded up) for @c
+   *  distribute_block and 1 for @c distribute_cyclic. */
+  int block;
+
+  array_dimension(int sz = 0, distribution_kind d = distribute_block, int b = 0)
+    : size(sz), distribution(d), block(b) {}
+};
+
+/**
+ * @brief The part of an N-dimensional array that each process of a
+ * communicator holds.
+ *
+ * A @c distributed_array_layout describes an array of global
+ * dimensions @c global_sizes(), stored in row major (C) order, and
+ * the elements of it the calling process holds: a local array of
+ * dimensions @c local_sizes(), also in row major order. It is used by
+ * @c file::read_array_all and @c file::write_array_all to access the
+ * whole array with a single collective operation, through a file view
+ * that selects the local part of each process.
+ *
+ * The layout is either computed from a process grid and a block or
+ * block-cyclic distribution per dimension (@c MPI_Type_create_darray),
+ * or given explicitly as one rectangular block per process (@c
+ * MPI_Type_create_subarray).
+ */
+class BOOST_MPI_DECL distributed_array_layout
+{
+public:
+  /**
+   * Distribute an array over a cartesian process grid. This is a
+   * local operation.
+   *
+   *   @param grid The processes, which must have as many dimensions
+   *   as the array; the process at coordinates @c c receives, along
+   *   each dimension @c d, the blocks numbered @c c[d] modulo the
+   *   size of the grid along @c d.
+   *
+   *   @param dims The size and distribution of the array along each
+   *   dimension.
+   */
+  distributed_array_layout(const cartesian_communicator& grid,
+                           const std::vector<array_dimension>& dims);
+
+  /**
+   * Give each process a rectangular block of the array. This is a
+   * local operation.
+   *
+   *   @param global_sizes The dimensions of the whole array.
+   *
+   *   @param local_sizes The dimensions of the block of the calling
+   *   process.
+   *
+   *   @param starts The coordinates, in the whole array, of the first
+   *   element of the block of the calling process.
+   */
+  distributed_array_layout(const std::vector<int>& global_sizes,
+                           const std::vector<int>& local_sizes,
+                           const std::vector<int>& starts);
+
+  /**
+   * The number of dimensions of the array.
+   */
+  int ndims() const { return int(m_global_sizes.size()); }
+
+  /**
+   * The dimensions of the whole array.
+   */
+  const std::vector<int>& global_sizes() const { return m_global_sizes; }
+
+  /**
+   * The dimensions of the part of the array of the calling process.
+   */
+  const std::vector<int>& local_sizes() const { return m_local_sizes; }
+
+  /**
+   * The number of elements of the part of the array of the calling
+   * process.
+   */
+  std::size_t local_size() const;
+
+  /**
+   * Build the MPI datatype that selects the part of the calling
+   * process in the whole array of @p etype elements. The type is
+   * committed; the caller must free it.
+   */
+  MPI_Datatype filetype(MPI_Datatype etype) const;
+
+private:
+  std::vector<int> m_global_sizes;
+  std::vector<int> m_local_sizes;
+  // Explicit blocks
+  std::vector<int> m_starts;
+  // Distribution over a process grid, if not empty
+  std::vector<int> m_distribs;
+  std::vector<int> m_dargs;
+  std::vector<int> m_psizes;
+  int              m_grid_size;
+  int              m_grid_rank;
+};
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_DISTRIBUTED_ARRAY_HPP
@@ -290,7 +290,7 @@ private:
   bool abort_on_exception;
   
   /// The number of reserved tags.
-  static const int num_reserved_tags = 1;
+  static const int num_reserved_tags = 3;
 };
 
 } } // end namespace boost::mpi
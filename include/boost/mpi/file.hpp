@@ -0,0 +1,317 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file file.hpp
+ *
+ *  This header defines the @c file class, which wraps the parallel
+ *  I/O facilities of MPI (MPI-IO), including collective writes and
+ *  reads of serialized data.
+ */
+#ifndef BOOST_MPI_FILE_HPP
+#define BOOST_MPI_FILE_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/status.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/shared_ptr.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost { namespace mpi {
+
+class distributed_array_layout;
+
+/**
+ * @brief A file opened collectively by the processes of a
+ * communicator.
+ *
+ * The @c file class gives the processes of a communicator concurrent
+ * access to a single file, through MPI-IO. Independent operations
+ * (@c write_at, @c read_at) involve only the calling process, while
+ * collective ones (@c write_at_all, @c read_at_all) must be called by
+ * all the processes of @c comm(), and let MPI merge their accesses
+ * into large contiguous requests to the file system.
+ *
+ * Offsets are counted in elementary types of the current view, which
+ * by default is the whole file seen as bytes. @c set_view gives each
+ * process its own, possibly non-contiguous, part of the file.
+ *
+ * @c write_array_all and @c read_array_all access an N-dimensional
+ * array split among the processes as described by a @c
+ * distributed_array_layout, in a single collective operation.
+ *
+ * @c write_serialized_all and @c read_serialized_all write and read
+ * back one serialized value per process, each process at its own
+ * place in the file, without gathering the data to any single
+ * process.
+ *
+ * Like communicators, @c file objects are handles: copies refer to
+ * the same MPI file, which is closed with the last copy, or by @c
+ * close().
+ */
+class BOOST_MPI_DECL file
+{
+public:
+  /**
+   * Build an object that does not refer to any file.
+   */
+  file() { }
+
+  /**
+   * Open a file (@c MPI_File_open). This is a collective operation
+   * over @p comm.
+   *
+   *   @param comm The processes that access the file.
+   *
+   *   @param filename The name of the file, the same on all the
+   *   processes.
+   *
+   *   @param amode A combination of the @c MPI_MODE_* flags, such as
+   *   <tt>MPI_MODE_CREATE | MPI_MODE_WRONLY</tt>.
+   *
+   *   @param info Hints for the MPI implementation.
+   */
+  file(const communicator& comm, const std::string& filename, int amode,
+       MPI_Info info = MPI_INFO_NULL);
+
+  /**
+   * The processes that opened the file.
+   */
+  const communicator& comm() const { return m_comm; }
+
+  /**
+   * Close the file. This is a collective operation over @c comm().
+   * All the copies of this object are affected. Closing a file that
+   * is not open does nothing.
+   */
+  void close();
+
+  /**
+   * The current size of the file, in bytes.
+   */
+  MPI_Offset size() const;
+
+  /**
+   * Truncate or extend the file to @p size bytes. This is a
+   * collective operation over @c comm().
+   */
+  void resize(MPI_Offset size);
+
+  /**
+   * Transfer the data written by all the processes to the storage
+   * device. This is a collective operation over @c comm().
+   */
+  void sync();
+
+  /**
+   * Set the view of the calling process on the file: skip @p disp
+   * bytes, then tile the file with @p filetype, of which only the
+   * data is visible. Offsets are then counted in @p etype. This is a
+   * collective operation over @c comm().
+   */
+  void set_view(MPI_Offset disp, MPI_Datatype etype, MPI_Datatype filetype,
+                const std::string& datarep = "native", MPI_Info info = MPI_INFO_NULL);
+
+  /**
+   * Set a contiguous view of @c T values after @p disp bytes.
+   */
+  template<typename T>
+  void set_view(MPI_Offset disp)
+  {
+    set_view(disp, get_mpi_datatype<T>(), get_mpi_datatype<T>());
+  }
+
+  /**
+   * Write @p n values at @p offset.
+   */
+  template<typename T>
+  status write_at(MPI_Offset offset, const T* values, int n)
+  {
+    BOOST_MPL_ASSERT((is_mpi_datatype<T>));
+    status stat;
+    BOOST_MPI_CHECK_RESULT(MPI_File_write_at,
+                           (*m_file, offset, const_cast<T*>(values), n,
+                            get_mpi_datatype<T>(), &stat.m_status));
+    return stat;
+  }
+
+  /**
+   * Read @p n values at @p offset.
+   */
+  template<typename T>
+  status read_at(MPI_Offset offset, T* values, int n)
+  {
+    BOOST_MPL_ASSERT((is_mpi_datatype<T>));
+    status stat;
+    BOOST_MPI_CHECK_RESULT(MPI_File_read_at,
+                           (*m_file, offset, values, n,
+                            get_mpi_datatype<T>(), &stat.m_status));
+    return stat;
+  }
+
+  /**
+   * Write @p n values at @p offset. This is a collective operation
+   * over @c comm(); @p offset and @p n may differ between processes.
+   */
+  template<typename T>
+  status write_at_all(MPI_Offset offset, const T* values, int n)
+  {
+    BOOST_MPL_ASSERT((is_mpi_datatype<T>));
+    status stat;
+    BOOST_MPI_CHECK_RESULT(MPI_File_write_at_all,
+                           (*m_file, offset, const_cast<T*>(values), n,
+                            get_mpi_datatype<T>(), &stat.m_status));
+    return stat;
+  }
+
+  /**
+   * Read @p n values at @p offset. This is a collective operation
+   * over @c comm(); @p offset and @p n may differ between processes.
+   */
+  template<typename T>
+  status read_at_all(MPI_Offset offset, T* values, int n)
+  {
+    BOOST_MPL_ASSERT((is_mpi_datatype<T>));
+    status stat;
+    BOOST_MPI_CHECK_RESULT(MPI_File_read_at_all,
+                           (*m_file, offset, values, n,
+                            get_mpi_datatype<T>(), &stat.m_status));
+    return stat;
+  }
+
+  /**
+   * Write the part of the calling process of an N-dimensional array,
+   * at the place given by @p layout in the whole array, stored in row
+   * major order at @p disp bytes in the file. This is a collective
+   * operation over @c comm(), that replaces the view of the file.
+   *
+   *   @param layout The part of the array of the calling process.
+   *
+   *   @param local The @c layout.local_size() values of the calling
+   *   process, as a row major array of dimensions @c
+   *   layout.local_sizes().
+   *
+   *   @param disp The place of the first element of the array in the
+   *   file, in bytes.
+   */
+  template<typename T>
+  void write_array_all(const distributed_array_layout& layout, const T* local,
+                       MPI_Offset disp = 0)
+  {
+    BOOST_MPL_ASSERT((is_mpi_datatype<T>));
+    write_array_all_impl(layout, get_mpi_datatype<T>(), local, disp);
+  }
+
+  /**
+   * Read the part of the calling process of an N-dimensional array,
+   * stored as by @c write_array_all. This is a collective operation
+   * over @c comm(), that replaces the view of the file. All the
+   * processes read their part at once, which lets MPI turn the
+   * accesses into a few large contiguous reads of the file, then
+   * exchange the data between processes.
+   *
+   *   @param layout The part of the array of the calling process.
+   *
+   *   @param local Room for the @c layout.local_size() values of the
+   *   calling process.
+   *
+   *   @param disp The place of the first element of the array in the
+   *   file, in bytes.
+   */
+  template<typename T>
+  void read_array_all(const distributed_array_layout& layout, T* local,
+                      MPI_Offset disp = 0)
+  {
+    BOOST_MPL_ASSERT((is_mpi_datatype<T>));
+    read_array_all_impl(layout, get_mpi_datatype<T>(), local, disp);
+  }
+
+  /**
+   * Serialize @p value on each process and write all the archives to
+   * the file, which must have been opened for writing. This is a
+   * collective operation over @c comm(), that resets the view of the
+   * file to bytes.
+   *
+   * The archives are stored one after the other in rank order, after
+   * an index that records the number of processes and the place of
+   * each archive. Each process computes its own offset with an
+   * exclusive scan of the archive sizes and writes its data directly.
+   */
+  template<typename T>
+  void write_serialized_all(const T& value)
+  {
+    packed_oarchive oa(m_comm);
+    oa << value;
+    write_packed_all(oa.address(), oa.size());
+  }
+
+  /**
+   * Read back, on each process, the value written by the process of
+   * the same rank with @c write_serialized_all. Each process only
+   * reads its own archive. This is a collective operation over @c
+   * comm(), which must have the size of the communicator the file
+   * was written with; it resets the view of the file to bytes.
+   */
+  template<typename T>
+  void read_serialized_all(T& value)
+  {
+    packed_iarchive::buffer_type buffer;
+    read_packed_all(buffer);
+    packed_iarchive ia(m_comm, buffer);
+    ia >> value;
+  }
+
+  /**
+   * Access the underlying MPI file.
+   */
+  operator MPI_File() const { return m_file ? *m_file : MPI_FILE_NULL; }
+
+  /**
+   * Determine whether this object refers to an open file.
+   */
+  operator bool() const { return m_file && *m_file != MPI_FILE_NULL; }
+
+private:
+  /**
+   * INTERNAL ONLY
+   */
+  void write_array_all_impl(const distributed_array_layout& layout, MPI_Datatype type,
+                            const void* local, MPI_Offset disp);
+
+  /**
+   * INTERNAL ONLY
+   */
+  void read_array_all_impl(const distributed_array_layout& layout, MPI_Datatype type,
+                           void* local, MPI_Offset disp);
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Write @p size bytes per process at a place of its own after the
+   * index.
+   */
+  void write_packed_all(const void* data, std::size_t size);
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Read the bytes written by the process of the same rank with @c
+   * write_packed_all.
+   */
+  void read_packed_all(packed_iarchive::buffer_type& buffer);
+
+  communicator         m_comm;
+  shared_ptr<MPI_File> m_file;
+};
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_FILE_HPP
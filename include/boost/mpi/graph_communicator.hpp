@@ -30,11 +30,28 @@
 #include <boost/graph/properties.hpp>
 #include <boost/iterator/counting_iterator.hpp>
 #include <boost/graph/iteration_macros.hpp>
-#include <boost/shared_array.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/assert.hpp>
 
 namespace boost { namespace mpi {
 
+namespace detail {
+  /**
+   * INTERNAL ONLY
+   *
+   * The graph topology of a communicator in compressed sparse row
+   * form: the targets of the edges outgoing from vertex @c v are
+   * stored in @c targets[offsets[v]] to @c targets[offsets[v+1]-1].
+   * It is retrieved from MPI once, when the communicator is built,
+   * and shared by all the copies of a communicator.
+   */
+  struct graph_csr
+  {
+    std::vector<int> offsets;
+    std::vector<int> targets;
+  };
+}
+
 /**
  * @brief An MPI communicator with a graph topology.
  *
@@ -58,15 +75,7 @@ class BOOST_MPI_DECL graph_communicator : public communicator
    * underlying MPI_Comm. This operation is used for "casting" from a
    * communicator to a graph communicator.
    */
-  explicit graph_communicator(const shared_ptr<MPI_Comm>& comm_ptr)
-  {
-#ifndef BOOST_DISABLE_ASSERTS
-    int status;
-    BOOST_MPI_CHECK_RESULT(MPI_Topo_test, ((MPI_Comm)*this, &status));
-    BOOST_ASSERT(status == MPI_GRAPH);
-#endif
-    this->comm_ptr = comm_ptr;
-  }
+  explicit graph_communicator(const shared_ptr<MPI_Comm>& comm_ptr);
 
 public:
   /**
@@ -96,15 +105,7 @@ public:
    *   scope. This option should only be used when the communicator is
    *   managed by the user.
    */
-  graph_communicator(const MPI_Comm& comm, comm_create_kind kind)
-    : communicator(comm, kind)
-  { 
-#ifndef BOOST_DISABLE_ASSERTS
-    int status;
-    BOOST_MPI_CHECK_RESULT(MPI_Topo_test, ((MPI_Comm)*this, &status));
-    BOOST_ASSERT(status == MPI_GRAPH);
-#endif
-  }
+  graph_communicator(const MPI_Comm& comm, comm_create_kind kind);
 
   /**
    *  Create a new communicator whose topology is described by the
@@ -167,6 +168,13 @@ public:
   graph_communicator(const communicator& comm, const Graph& graph, 
                      RankMap rank, bool reorder = false);
 
+  /**
+   * INTERNAL ONLY
+   *
+   * The graph topology, as fetched from MPI on construction.
+   */
+  const detail::graph_csr& csr() const { return *m_csr; }
+
 protected:
   /**
    * INTERNAL ONLY
@@ -178,6 +186,16 @@ protected:
   void
   setup_graph(const communicator& comm, const Graph& graph, RankMap rank, 
               bool reorder);
+
+  /**
+   * INTERNAL ONLY
+   *
+   * Retrieve the graph topology from MPI, with @c MPI_Graph_get.
+   */
+  void fetch_graph();
+
+private:
+  shared_ptr<const detail::graph_csr> m_csr;
 };
 
 /****************************************************************************
@@ -210,8 +228,10 @@ graph_communicator::setup_graph(const communicator& comm, const Graph& graph,
 
   // Build a mapping from ranks to vertices
   std::vector<vertex_descriptor> vertex_with_rank(num_vertices(graph));
-  if (vertex_with_rank.empty())
+  if (vertex_with_rank.empty()) {
+    fetch_graph();
     return;
+  }
 
   BGL_FORALL_VERTICES_T(v, graph, Graph)
     vertex_with_rank[get(rank, v)] = v;
@@ -240,6 +260,7 @@ graph_communicator::setup_graph(const communicator& comm, const Graph& graph,
                           reorder,
                           &newcomm));
   this->comm_ptr.reset(new MPI_Comm(newcomm), comm_free());
+  fetch_graph();
 }
 
 /****************************************************************************
@@ -260,40 +281,38 @@ namespace detail {
                              int>
   {
   public:
-    comm_out_edge_iterator() { }
+    comm_out_edge_iterator() : neighbor(0) { }
 
-    comm_out_edge_iterator(int source, shared_array<int> neighbors, int index)
-      : edge(source, -1), neighbors(neighbors), index(index) { }
+    comm_out_edge_iterator(int source, const int* neighbor)
+      : edge(source, -1), neighbor(neighbor) { }
 
   protected:
     friend class boost::iterator_core_access;
 
     const std::pair<int, int>& dereference() const
     {
-      edge.second = neighbors[index];
+      edge.second = *neighbor;
       return edge;
     }
 
     bool equal(const comm_out_edge_iterator& other) const
     {
-      return (edge.first == other.edge.first
-              && index == other.index);
+      return neighbor == other.neighbor;
     }
 
-    void increment() { ++index; }
+    void increment() { ++neighbor; }
 
-    void decrement() { --index; }
+    void decrement() { --neighbor; }
 
-    void advance(int n) { index += n; }
+    void advance(int n) { neighbor += n; }
 
     int distance_to(const comm_out_edge_iterator& other) const
     {
-      return other.index - index;
+      return other.neighbor - neighbor;
     }
 
     mutable std::pair<int, int> edge;
-    shared_array<int> neighbors;
-    int index;
+    const int* neighbor;
   };
 
   /**
@@ -310,35 +329,32 @@ namespace detail {
                              int>
   {
   public:
-    comm_adj_iterator() { }
+    comm_adj_iterator() : neighbor(0) { }
 
-    comm_adj_iterator(shared_array<int> neighbors, int index)
-      : neighbors(neighbors), index(index) { }
+    explicit comm_adj_iterator(const int* neighbor) : neighbor(neighbor) { }
 
   protected:
     friend class boost::iterator_core_access;
 
-    int dereference() const { return neighbors[index]; }
+    int dereference() const { return *neighbor; }
 
     bool equal(const comm_adj_iterator& other) const
     {
-      return (neighbors == other.neighbors
-              && index == other.index);
+      return neighbor == other.neighbor;
     }
 
-    void increment() { ++index; }
+    void increment() { ++neighbor; }
 
-    void decrement() { --index; }
+    void decrement() { --neighbor; }
 
-    void advance(int n) { index += n; }
+    void advance(int n) { neighbor += n; }
 
     int distance_to(const comm_adj_iterator& other) const
     {
-      return other.index - index;
+      return other.neighbor - neighbor;
     }
 
-    shared_array<int> neighbors;
-    int index;
+    const int* neighbor;
   };
 
   /**
@@ -355,23 +371,23 @@ namespace detail {
                              int>
   {
   public:
-    comm_edge_iterator() { }
+    comm_edge_iterator() : csr(0), edge_index(0) { }
 
     /// Constructor for a past-the-end iterator
-    comm_edge_iterator(int nedges) : edge_index(nedges) { }
+    comm_edge_iterator(int nedges) : csr(0), edge_index(nedges) { }
 
-    comm_edge_iterator(shared_array<int> indices, shared_array<int> edges)
-      : indices(indices), edges(edges), edge_index(0), edge(0, 0)
-    { }
+    explicit comm_edge_iterator(const graph_csr& csr)
+      : csr(&csr), edge_index(0), edge(0, 0)
+    { 
+      skip_empty_vertices();
+    }
 
   protected:
     friend class boost::iterator_core_access;
 
     const std::pair<int, int>& dereference() const
     {
-      while (edge_index == indices[edge.first])
-        ++edge.first;
-      edge.second = edges[edge_index];
+      edge.second = csr->targets[edge_index];
       return edge;
     }
 
@@ -383,10 +399,19 @@ namespace detail {
     void increment() 
     { 
       ++edge_index; 
+      skip_empty_vertices();
+    }
+
+    // Move the source vertex forward to the vertex that owns the
+    // current edge.
+    void skip_empty_vertices()
+    {
+      int nedges = csr->targets.size();
+      while (edge_index < nedges && edge_index == csr->offsets[edge.first + 1])
+        ++edge.first;
     }
 
-    shared_array<int> indices;
-    shared_array<int> edges;
+    const graph_csr* csr;
     int edge_index;
     mutable std::pair<int, int> edge;
   };
@@ -417,6 +442,9 @@ inline int target(const std::pair<int, int>& edge, const graph_communicator&)
  * @brief Returns an iterator range containing all of the edges
  * outgoing from the given vertex in a graph topology of a
  * communicator.
+ *
+ * The iterators walk the topology cached in @p comm and remain valid
+ * as long as @p comm, or one of its copies, exists.
  */
 BOOST_MPI_DECL std::pair<detail::comm_out_edge_iterator, detail::comm_out_edge_iterator>
 out_edges(int vertex, const graph_communicator& comm);
@@ -434,7 +462,7 @@ BOOST_MPI_DECL int out_degree(int vertex, const graph_communicator& comm);
  * @brief Returns an iterator range containing all of the neighbors of
  * the given vertex in the communicator's graph topology.
  */
-std::pair<detail::comm_adj_iterator, detail::comm_adj_iterator>
+BOOST_MPI_DECL std::pair<detail::comm_adj_iterator, detail::comm_adj_iterator>
 adjacent_vertices(int vertex, const graph_communicator& comm);
 
 // Vertex List Graph requirements
@@ -22,9 +22,55 @@
 #include <boost/mpi/request.hpp>
 #include <boost/mpi/status.hpp>
 #include <boost/mpi/exception.hpp>
+#include <boost/mpi/wait_policy.hpp>
 
 namespace boost { namespace mpi {
 
+namespace detail {
+  /**
+   * Wait as @p w says after a pass over @c [first,last) that
+   * completed no request. If it blocks in MPI until a plain MPI
+   * request completes, returns that request, with its status in @p
+   * stat; otherwise returns @p last.
+   *
+   * Blocking on the plain requests alone is only safe when the other
+   * requests complete without being tested, and, unless @p all of
+   * the requests are awaited, when there are no others, since their
+   * completion would not end the block.
+   */
+  template<typename Iterator>
+  Iterator
+  wait_pause(waiter& w, Iterator first, Iterator last, status& stat, bool all)
+  {
+    std::vector<MPI_Request> requests;
+    std::vector<Iterator> positions;
+    if (w.may_block()) {
+      for (Iterator current = first; current != last; ++current) {
+        if (current->active()) {
+          if (optional<MPI_Request&> r = current->trivial()) {
+            requests.push_back(*r);
+            positions.push_back(current);
+          } else if (!all || !current->progresses()) {
+            requests.clear();
+            break;
+          }
+        }
+      }
+    }
+    if (!w.pause(!requests.empty())) {
+      return last;
+    }
+    int index;
+    BOOST_MPI_CHECK_RESULT(MPI_Waitany,
+                           (int(requests.size()), c_data(requests), &index, &stat.m_status));
+    if (index == MPI_UNDEFINED) {
+      return last;
+    }
+    *positions[index]->trivial() = requests[index];
+    return positions[index];
+  }
+} // end namespace detail
+
 /** 
  *  @brief Wait until any non-blocking request has completed.
  *
@@ -39,13 +85,17 @@ namespace boost { namespace mpi {
  *  @param last The iterator that denotes the end of the sequence of
  *  request objects. This may not be equal to @c first.
  *
+ *  @param policy What to do between passes over the requests, when
+ *  they cannot all be waited for by MPI. The default is @c
+ *  default_wait_policy().
+ *
  *  @returns A pair containing the status object that corresponds to
  *  the completed operation and the iterator referencing the completed
  *  request.
  */
 template<typename ForwardIterator>
 std::pair<status, ForwardIterator> 
-wait_any(ForwardIterator first, ForwardIterator last)
+wait_any(ForwardIterator first, ForwardIterator last, const wait_policy& policy)
 {
   using std::advance;
 
@@ -54,6 +104,7 @@ wait_any(ForwardIterator first, ForwardIterator last)
   typedef typename std::iterator_traits<ForwardIterator>::difference_type
     difference_type;
 
+  detail::waiter waiter(policy);
   bool all_trivial_requests = true;
   difference_type n = 0;
   ForwardIterator current = first;
@@ -106,7 +157,12 @@ wait_any(ForwardIterator first, ForwardIterator last)
       }
 
       // There are some nontrivial requests, so we must continue our
-      // busy waiting loop.
+      // busy waiting loop, as the policy says.
+      status stat;
+      current = detail::wait_pause(waiter, first, last, stat, false);
+      if (current != last) {
+        return std::make_pair(stat, current);
+      }
       n = 0;
       current = first;
       all_trivial_requests = true;
@@ -117,6 +173,16 @@ wait_any(ForwardIterator first, ForwardIterator last)
   BOOST_ASSERT(false);
 }
 
+/**
+ * \overload
+ */
+template<typename ForwardIterator>
+std::pair<status, ForwardIterator> 
+wait_any(ForwardIterator first, ForwardIterator last)
+{
+  return wait_any(first, last, default_wait_policy());
+}
+
 /** 
  *  @brief Test whether any non-blocking request has completed.
  *
@@ -172,12 +238,17 @@ test_any(ForwardIterator first, ForwardIterator last)
  *  emitted in the same order as the requests are retrieved from 
  *  @c [first,last).
  *
+ *  @param policy What to do between passes over the requests, when
+ *  they cannot all be waited for by MPI. The default is @c
+ *  default_wait_policy().
+ *
  *  @returns If an @p out parameter was provided, the value @c out
  *  after all of the @c status objects have been emitted.
  */
 template<typename ForwardIterator, typename OutputIterator>
 OutputIterator 
-wait_all(ForwardIterator first, ForwardIterator last, OutputIterator out)
+wait_all(ForwardIterator first, ForwardIterator last, OutputIterator out,
+         const wait_policy& policy)
 {
   typedef typename std::iterator_traits<ForwardIterator>::difference_type
     difference_type;
@@ -188,9 +259,11 @@ wait_all(ForwardIterator first, ForwardIterator last, OutputIterator out)
 
   std::vector<status> results(num_outstanding_requests);
   std::vector<bool> completed(num_outstanding_requests);
+  detail::waiter waiter(policy);
 
   while (num_outstanding_requests > 0) {
     bool all_trivial_requests = true;
+    bool progressed = false;
     difference_type idx = 0;
     for (ForwardIterator current = first; current != last; ++current, ++idx) {
       if (!completed[idx]) {
@@ -203,6 +276,7 @@ wait_all(ForwardIterator first, ForwardIterator last, OutputIterator out)
           completed[idx] = true;
           --num_outstanding_requests;
           all_trivial_requests = false;
+          progressed = true;
         } else {
           // Check if this request (and all others before it) are "trivial"
           // requests, e.g., they can be represented with a single
@@ -238,18 +312,37 @@ wait_all(ForwardIterator first, ForwardIterator last, OutputIterator out)
       return out;
     }
 
-    all_trivial_requests = false;
+    if (num_outstanding_requests > 0 && !progressed) {
+      status stat;
+      ForwardIterator current = detail::wait_pause(waiter, first, last, stat, true);
+      if (current != last) {
+        difference_type idx = distance(first, current);
+        results[idx] = stat;
+        completed[idx] = true;
+        --num_outstanding_requests;
+      }
+    }
   }
 
   return std::copy(results.begin(), results.end(), out);
 }
 
+/**
+ * \overload
+ */
+template<typename ForwardIterator, typename OutputIterator>
+OutputIterator 
+wait_all(ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+  return wait_all(first, last, out, default_wait_policy());
+}
+
 /**
  * \overload
  */
 template<typename ForwardIterator>
 void
-wait_all(ForwardIterator first, ForwardIterator last)
+wait_all(ForwardIterator first, ForwardIterator last, const wait_policy& policy)
 {
   typedef typename std::iterator_traits<ForwardIterator>::difference_type
     difference_type;
@@ -259,9 +352,11 @@ wait_all(ForwardIterator first, ForwardIterator last)
   difference_type num_outstanding_requests = distance(first, last);
 
   std::vector<bool> completed(num_outstanding_requests, false);
+  detail::waiter waiter(policy);
 
   while (num_outstanding_requests > 0) {
     bool all_trivial_requests = true;
+    bool progressed = false;
 
     difference_type idx = 0;
     for (ForwardIterator current = first; current != last; ++current, ++idx) {
@@ -274,6 +369,7 @@ wait_all(ForwardIterator first, ForwardIterator last)
           completed[idx] = true;
           --num_outstanding_requests;
           all_trivial_requests = false;
+          progressed = true;
         } else {
           // Check if this request (and all others before it) are "trivial"
           // requests, e.g., they can be represented with a single
@@ -300,10 +396,27 @@ wait_all(ForwardIterator first, ForwardIterator last)
 
       // Signal completion
       num_outstanding_requests = 0;
+    } else if (num_outstanding_requests > 0 && !progressed) {
+      status stat;
+      ForwardIterator current = detail::wait_pause(waiter, first, last, stat, true);
+      if (current != last) {
+        completed[distance(first, current)] = true;
+        --num_outstanding_requests;
+      }
     }
   }
 }
 
+/**
+ * \overload
+ */
+template<typename ForwardIterator>
+void
+wait_all(ForwardIterator first, ForwardIterator last)
+{
+  wait_all(first, last, default_wait_policy());
+}
+
 /** 
  *  @brief Tests whether all non-blocking requests have completed.
  *
@@ -408,6 +521,10 @@ test_all(ForwardIterator first, ForwardIterator last)
  *
  *  @param out If provided, the @c status objects corresponding to
  *  completed requests will be emitted through this output iterator.
+ *
+ *  @param policy What to do between passes over the requests, when
+ *  they cannot all be waited for by MPI. The default is @c
+ *  default_wait_policy().
 
  *  @returns If the @p out parameter was provided, a pair containing
  *  the output iterator @p out after all of the @c status objects have
@@ -418,7 +535,7 @@ test_all(ForwardIterator first, ForwardIterator last)
 template<typename BidirectionalIterator, typename OutputIterator>
 std::pair<OutputIterator, BidirectionalIterator> 
 wait_some(BidirectionalIterator first, BidirectionalIterator last,
-          OutputIterator out)
+          OutputIterator out, const wait_policy& policy)
 {
   using std::advance;
 
@@ -428,6 +545,7 @@ wait_some(BidirectionalIterator first, BidirectionalIterator last,
   typedef typename std::iterator_traits<BidirectionalIterator>::difference_type
     difference_type;
 
+  detail::waiter waiter(policy);
   bool all_trivial_requests = true;
   difference_type n = 0;
   BidirectionalIterator current = first;
@@ -523,9 +641,19 @@ wait_some(BidirectionalIterator first, BidirectionalIterator last,
       }
 
       // There are some nontrivial requests, so we must continue our
-      // busy waiting loop.
+      // busy waiting loop, as the policy says.
+      status stat;
+      current = detail::wait_pause(waiter, first, last, stat, false);
+      if (current != last) {
+        using std::iter_swap;
+        *out++ = stat;
+        --start_of_completed;
+        iter_swap(current, start_of_completed);
+        return std::make_pair(out, start_of_completed);
+      }
       n = 0;
       current = first;
+      all_trivial_requests = true;
     }
   }
 
@@ -533,12 +661,24 @@ wait_some(BidirectionalIterator first, BidirectionalIterator last,
   BOOST_ASSERT(false);
 }
 
+/**
+ * \overload
+ */
+template<typename BidirectionalIterator, typename OutputIterator>
+std::pair<OutputIterator, BidirectionalIterator> 
+wait_some(BidirectionalIterator first, BidirectionalIterator last,
+          OutputIterator out)
+{
+  return wait_some(first, last, out, default_wait_policy());
+}
+
 /**
  *  \overload
  */
 template<typename BidirectionalIterator>
 BidirectionalIterator
-wait_some(BidirectionalIterator first, BidirectionalIterator last)
+wait_some(BidirectionalIterator first, BidirectionalIterator last,
+          const wait_policy& policy)
 {
   using std::advance;
 
@@ -548,6 +688,7 @@ wait_some(BidirectionalIterator first, BidirectionalIterator last)
   typedef typename std::iterator_traits<BidirectionalIterator>::difference_type
     difference_type;
 
+  detail::waiter waiter(policy);
   bool all_trivial_requests = true;
   difference_type n = 0;
   BidirectionalIterator current = first;
@@ -623,9 +764,18 @@ wait_some(BidirectionalIterator first, BidirectionalIterator last)
       }
 
       // There are some nontrivial requests, so we must continue our
-      // busy waiting loop.
+      // busy waiting loop, as the policy says.
+      status stat;
+      current = detail::wait_pause(waiter, first, last, stat, false);
+      if (current != last) {
+        using std::iter_swap;
+        --start_of_completed;
+        iter_swap(current, start_of_completed);
+        return start_of_completed;
+      }
       n = 0;
       current = first;
+      all_trivial_requests = true;
     }
   }
 
@@ -633,6 +783,16 @@ wait_some(BidirectionalIterator first, BidirectionalIterator last)
   BOOST_ASSERT(false);
 }
 
+/**
+ *  \overload
+ */
+template<typename BidirectionalIterator>
+BidirectionalIterator
+wait_some(BidirectionalIterator first, BidirectionalIterator last)
+{
+  return wait_some(first, last, default_wait_policy());
+}
+
 /** 
  *  @brief Test whether some non-blocking requests have completed.
  *
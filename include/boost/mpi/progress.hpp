@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file progress.hpp
+ *
+ *  This header provides the progress engine, which advances the
+ *  non-blocking receives of serialized data while the program does
+ *  something else.
+ */
+#ifndef BOOST_MPI_PROGRESS_HPP
+#define BOOST_MPI_PROGRESS_HPP
+
+#include <boost/mpi/config.hpp>
+
+namespace boost { namespace mpi {
+
+/**
+ * @brief How the non-blocking receives of serialized data are
+ * advanced.
+ *
+ * A non-blocking receive of a serialized value (or of a @c
+ * std::vector whose size is unknown) is not a single MPI request: the
+ * size of the archive must be received (or probed) before the
+ * archive, then the value must be deserialized. Without help, each
+ * step is only taken when the request is tested or waited for, so the
+ * transfer of the archive does not overlap the computations made in
+ * between.
+ */
+enum progress_mode {
+  /** The requests only progress when tested or waited for. */
+  progress_none,
+  /** The requests also progress when @c progress() is called. */
+  progress_manual,
+  /** A thread of the library calls @c progress() periodically.
+   *  Requires @c threading::multiple. */
+  progress_background
+};
+
+/**
+ * Start advancing the non-blocking receives of serialized data that
+ * are made from now on, until @c stop_progress() is called. The
+ * requests made before are not affected.
+ *
+ * With @c progress_background, a thread of the library advances the
+ * requests, waiting @p interval microseconds between passes; since
+ * it calls MPI concurrently with the other threads, MPI must have been
+ * initialized with @c threading::multiple, or an @c exception is
+ * thrown. With @c progress_manual, the program calls @c progress(),
+ * for instance in its main loop; this works at any threading level,
+ * from the main thread with @c threading::funneled.
+ *
+ * Once a request has been advanced to completion, its @c test() and
+ * @c wait() return at once; @c active() stays true until then, so
+ * that @c wait_any and the like still report it.
+ */
+BOOST_MPI_DECL void start_progress(progress_mode mode, int interval = 100);
+
+/**
+ * Stop advancing the requests in the background, and stop registering
+ * the new requests. This is called by the destructor of the @c
+ * environment, before @c MPI_Finalize.
+ */
+BOOST_MPI_DECL void stop_progress();
+
+/**
+ * The mode set by the last call to @c start_progress, or @c
+ * progress_none.
+ */
+BOOST_MPI_DECL progress_mode current_progress_mode();
+
+/**
+ * Advance each of the registered requests by as many steps as it can
+ * take without blocking. Requests that are being tested or waited for
+ * by another thread are left alone.
+ *
+ *   @returns The number of requests completed by this call.
+ */
+BOOST_MPI_DECL int progress();
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_PROGRESS_HPP
@@ -16,12 +16,15 @@
 #include <boost/mpi/status.hpp>
 #include <boost/mpi/optional.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/function.hpp>
 #include <boost/mpi/packed_iarchive.hpp>
 
 namespace boost { namespace mpi {
 
 class status;
 class communicator;
+class completion_queue;
+class termination_detector;
 
 /**
  *  @brief A request for a non-blocking send or receive.
@@ -59,6 +62,26 @@ class BOOST_MPI_DECL request
 
   static request make_bottom_recv(communicator const& comm, int dest, int tag, MPI_Datatype tp);
   static request make_empty_recv(communicator const& comm, int dest, int tag);
+#if BOOST_MPI_VERSION >= 3
+  /**
+   * Put (get) a known number of primitive objects to (from) the
+   * memory exposed by a window in one MPI request.
+   */
+  template<typename T>
+  static request make_trivial_put(MPI_Win win, int target, MPI_Aint disp, T const* values, int n);
+  template<typename T>
+  static request make_trivial_get(MPI_Win win, int target, MPI_Aint disp, T* values, int n);
+  /**
+   * Start a non-blocking barrier, broadcast or all-reduce of
+   * primitive objects, in one MPI request.
+   */
+  static request make_ibarrier(communicator const& comm);
+  template<typename T>
+  static request make_ibroadcast(communicator const& comm, T* values, int n, int root);
+  template<typename T>
+  static request make_iall_reduce(communicator const& comm, T const* in_values, T* out_values,
+                                  int n, MPI_Op op);
+#endif
   /**
    * Construct request for simple data of unknown size.
    */
@@ -122,10 +145,34 @@ class BOOST_MPI_DECL request
    * Is this request potentialy pending ?
    */
   bool active() const { return bool(m_handler) && m_handler->active(); }
+
+  /**
+   * Does this request complete without being tested, like a plain
+   * MPI request? A receive of serialized data does not, unless the
+   * progress engine advances it in the background.
+   * Probably irrelevant to most users.
+   */
+  bool progresses() const { return bool(m_handler) && m_handler->progresses(); }
   
   // Some data might need protection while the reqest is processed.
   void preserve(boost::shared_ptr<void> d);
 
+  /**
+   * Attach a continuation to this request, to be called with the @c
+   * status of the communication when it completes, by the @c
+   * completion_queue the request is pushed to. It can, for instance,
+   * post the next receive.
+   *
+   *   @returns This request, so that
+   *   <tt>queue.push(comm.irecv(src, tag, value).then(f))</tt>
+   *   registers a receive and its continuation at once.
+   */
+  request& then(const function<void (const status&)>& f)
+  {
+    m_continuation = f;
+    return *this;
+  }
+
   class handler {
   public:
     virtual BOOST_MPI_DECL ~handler() = 0;
@@ -135,12 +182,19 @@ class BOOST_MPI_DECL request
     
     virtual bool active() const = 0;
     virtual optional<MPI_Request&> trivial() = 0;
+    virtual bool progresses() const { return false; }
   };
   
  private:
   
   request(handler *h) : m_handler(h) {};
 
+  // A request for h, that the progress engine advances if it runs.
+  static request progressed(handler *h);
+
+  friend class completion_queue;
+  friend class termination_detector;
+
   // specific implementations
   class legacy_handler;
   class trivial_handler;  
@@ -154,6 +208,7 @@ class BOOST_MPI_DECL request
  private:
   shared_ptr<handler> m_handler;
   shared_ptr<void>    m_preserved;
+  function<void (const status&)> m_continuation;
 };
 
 } } // end namespace boost::mpi
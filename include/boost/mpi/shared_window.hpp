@@ -0,0 +1,283 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file shared_window.hpp
+ *
+ *  This header defines the @c shared_window class template, which
+ *  gives the processes of a node direct, typed access to each
+ *  other's memory through an MPI shared memory window (MPI 3.0,
+ *  @c MPI_Win_allocate_shared).
+ */
+#ifndef BOOST_MPI_SHARED_WINDOW_HPP
+#define BOOST_MPI_SHARED_WINDOW_HPP
+
+#include <boost/mpi/config.hpp>
+
+#if BOOST_MPI_VERSION >= 3
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/window.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/detail/node_hierarchy.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+/**
+ * @brief A window of memory shared by the processes of a node.
+ *
+ * A @c shared_window allocates, on each process, a segment of @c T
+ * values that every other process of the same node can read and
+ * write directly, with plain loads and stores, through the @c span
+ * returned by @c segment(). The node of a process is given by the
+ * @c communicator::node_communicator of the communicator the window
+ * is built on; processes of other nodes are not part of the window.
+ *
+ * @c T must be trivially copyable: the values are accessed in place
+ * by several processes, and copied as bytes by @c broadcast.
+ *
+ * Like communicators, @c shared_window objects are handles: copies
+ * refer to the same MPI window, which is freed with the last copy.
+ * Accesses must be synchronized, either with @c fence() or within a
+ * @c lock_all() / @c unlock_all() epoch using @c sync() and some
+ * process synchronization.
+ */
+template<typename T>
+class shared_window
+{
+public:
+  /**
+   * @brief A contiguous range of @c T in a shared window.
+   */
+  class span
+  {
+  public:
+    typedef T           value_type;
+    typedef T*          iterator;
+    typedef std::size_t size_type;
+
+    span() : first(0), count(0) { }
+    span(T* first, std::size_t count) : first(first), count(count) { }
+
+    T* begin() const { return first; }
+    T* end() const { return first + count; }
+    T* data() const { return first; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    T& operator[](std::size_t i) const { return first[i]; }
+
+  private:
+    T*          first;
+    std::size_t count;
+  };
+
+  /**
+   * Build an empty window, that does not refer to any MPI window.
+   */
+  shared_window() { }
+
+  /**
+   * Allocate a shared window. This is a collective operation over
+   * @p comm, which is split into nodes as by @c
+   * communicator::node_communicator.
+   *
+   *   @param comm The communicator whose processes take part in the
+   *   window.
+   *
+   *   @param count The number of values allocated by the calling
+   *   process. It can differ from process to process, and be zero,
+   *   e.g. when only one process per node holds the data.
+   *
+   *   @param contiguous Whether the segments of the processes of a
+   *   node must be allocated one after the other, in node rank order.
+   *   Non-contiguous allocation lets MPI place each segment close to
+   *   its owner.
+   */
+  shared_window(const communicator& comm, std::size_t count, bool contiguous = true);
+
+  /**
+   * The communicator the window was built on.
+   */
+  const communicator& comm() const { return m_comm; }
+
+  /**
+   * The processes of the node of the calling process, whose segments
+   * can be accessed.
+   */
+  const communicator& node() const { return m_hierarchy.node; }
+
+  /**
+   * The segment allocated by the process of rank @p node_rank in @c
+   * node().
+   */
+  span segment(int node_rank) const { return m_segments[node_rank]; }
+
+  /**
+   * The segment allocated by the calling process.
+   */
+  span local() const { return m_segments[m_hierarchy.node.rank()]; }
+
+  /**
+   * Synchronize all the processes of the node, and make the writes
+   * performed before the fence visible to the reads performed after
+   * it. This is a collective operation over @c node().
+   *
+   *   @param assert The @c MPI_MODE_* assertions for @c MPI_Win_fence.
+   */
+  void fence(int assert = 0) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_fence, (assert, *m_win));
+  }
+
+  /**
+   * Start a passive target access epoch on all the segments.
+   *
+   *   @param assert The @c MPI_MODE_* assertions for @c
+   *   MPI_Win_lock_all.
+   */
+  void lock_all(int assert = 0) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_lock_all, (assert, *m_win));
+  }
+
+  /**
+   * End the access epoch started by @c lock_all().
+   */
+  void unlock_all() const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_unlock_all, (*m_win));
+  }
+
+  /**
+   * Synchronize the public and private copies of the window, within
+   * a @c lock_all() epoch. Combined with a process synchronization,
+   * such as a barrier on @c node(), it makes the writes of a process
+   * visible to the others.
+   */
+  void sync() const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_sync, (*m_win));
+  }
+
+  /**
+   * Copy the segment of the process of rank @p root in @c comm() to
+   * the segment of the process of node rank 0 of every node, so that
+   * a large read-only data set exists once per node instead of once
+   * per process. Only one message per node goes through the network.
+   * This is a collective operation over @c comm(), which must not be
+   * within a @c lock_all() epoch.
+   *
+   * Every segment of node rank 0 must be able to hold the segment of
+   * @p root.
+   */
+  void broadcast(int root) const;
+
+  /**
+   * Access the underlying MPI window.
+   */
+  operator MPI_Win() const { return m_win ? *m_win : MPI_WIN_NULL; }
+
+  /**
+   * Determine whether this object refers to an MPI window.
+   */
+  operator bool() const { return bool(m_win); }
+
+private:
+  communicator           m_comm;
+  detail::node_hierarchy m_hierarchy;
+  shared_ptr<MPI_Win>    m_win;
+  std::vector<span>     m_segments;
+};
+
+template<typename T>
+shared_window<T>::shared_window(const communicator& comm, std::size_t count,
+                                bool contiguous)
+  : m_comm(comm), m_hierarchy(detail::shared_memory_hierarchy(comm))
+{
+  const communicator& node = m_hierarchy.node;
+  MPI_Info info = MPI_INFO_NULL;
+  if (!contiguous) {
+    BOOST_MPI_CHECK_RESULT(MPI_Info_create, (&info));
+    BOOST_MPI_CHECK_RESULT(MPI_Info_set,
+                           (info, const_cast<char*>("alloc_shared_noncontig"),
+                            const_cast<char*>("true")));
+  }
+  void* base;
+  MPI_Win win;
+  int result = MPI_Win_allocate_shared(MPI_Aint(count * sizeof(T)), int(sizeof(T)),
+                                       info, MPI_Comm(node), &base, &win);
+  if (info != MPI_INFO_NULL)
+    BOOST_MPI_CHECK_RESULT(MPI_Info_free, (&info));
+  if (result != MPI_SUCCESS)
+    boost::throw_exception(exception("MPI_Win_allocate_shared", result));
+  m_win.reset(new MPI_Win(win), detail::win_free());
+
+  // The sizes reported by MPI_Win_shared_query may be rounded up by
+  // the implementation, so the counts are exchanged explicitly.
+  int node_size = node.size();
+  unsigned long local_count = count;
+  std::vector<unsigned long> counts(node_size);
+  BOOST_MPI_CHECK_RESULT(MPI_Allgather,
+                         (&local_count, 1, MPI_UNSIGNED_LONG,
+                          &counts[0], 1, MPI_UNSIGNED_LONG, MPI_Comm(node)));
+  m_segments.reserve(node_size);
+  for (int r = 0; r < node_size; ++r) {
+    MPI_Aint size;
+    int disp_unit;
+    void* ptr;
+    BOOST_MPI_CHECK_RESULT(MPI_Win_shared_query, (win, r, &size, &disp_unit, &ptr));
+    m_segments.push_back(span(static_cast<T*>(ptr), std::size_t(counts[r])));
+  }
+}
+
+template<typename T>
+void
+shared_window<T>::broadcast(int root) const
+{
+  const detail::node_hierarchy& h = m_hierarchy;
+  span target = segment(0);
+
+  // Within the node of root, root copies its segment to the leader's.
+  fence();
+  if (m_comm.rank() == root && h.node_rank_of[root] != 0) {
+    BOOST_ASSERT(target.size() >= local().size());
+    std::copy(local().begin(), local().end(), target.begin());
+  }
+  fence();
+
+  // The leaders forward it to the other nodes, in pieces that fit
+  // the int counts of MPI.
+  if (h.leaders) {
+    int root_node = h.node_of[root];
+    unsigned long count = 0;
+    if (h.leaders.rank() == root_node)
+      count = segment(h.node_rank_of[root]).size();
+    BOOST_MPI_CHECK_RESULT(MPI_Bcast,
+                           (&count, 1, MPI_UNSIGNED_LONG, root_node, MPI_Comm(h.leaders)));
+    BOOST_ASSERT(target.size() >= count);
+    char* bytes = reinterpret_cast<char*>(target.data());
+    std::size_t remaining = count * sizeof(T);
+    std::size_t const chunk = std::size_t(1) << 30;
+    while (remaining > 0) {
+      int n = int(std::min(remaining, chunk));
+      BOOST_MPI_CHECK_RESULT(MPI_Bcast,
+                             (bytes, n, MPI_BYTE, root_node, MPI_Comm(h.leaders)));
+      bytes += n;
+      remaining -= n;
+    }
+  }
+  fence();
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_VERSION >= 3
+
+#endif // BOOST_MPI_SHARED_WINDOW_HPP
@@ -0,0 +1,471 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file submission_queue.hpp
+ *
+ *  This header defines the @c submission_queue class, through which
+ *  any thread can have communications made by a single thread that
+ *  owns MPI. It requires C++11 threads, atomics and futures; without
+ *  them, it is empty and @c BOOST_MPI_HAS_SUBMISSION_QUEUE is not
+ *  defined.
+ */
+#ifndef BOOST_MPI_SUBMISSION_QUEUE_HPP
+#define BOOST_MPI_SUBMISSION_QUEUE_HPP
+
+#include <boost/mpi/config.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_FUTURE) \
+  && !defined(BOOST_NO_CXX11_HDR_THREAD)
+#  define BOOST_MPI_HAS_SUBMISSION_QUEUE 1
+#endif
+
+#if defined(BOOST_MPI_HAS_SUBMISSION_QUEUE)
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/operations.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/status.hpp>
+#include <boost/mpi/detail/mpsc_queue.hpp>
+#include <boost/mpl/bool.hpp>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  // An operation submitted to a submission_queue.
+  class submitted_operation : public mpsc_node
+  {
+  public:
+    virtual ~submitted_operation() {}
+    // Start the operation, in the owner thread. Returns whether it
+    // then waits for m_request.
+    virtual bool start(const communicator& comm) = 0;
+    // Report the completion of m_request.
+    virtual void finish(const status& s) = 0;
+    virtual void fail(std::exception_ptr e) = 0;
+
+    request m_request;
+  };
+
+  // An operation that completes with the status of its request.
+  class request_operation : public submitted_operation
+  {
+  public:
+    void finish(const status& s) { m_promise.set_value(s); }
+    void fail(std::exception_ptr e) { m_promise.set_exception(e); }
+
+    std::promise<status> m_promise;
+  };
+
+  template<typename T>
+  class send_operation : public request_operation
+  {
+  public:
+    send_operation(int dest, int tag, const T& value)
+      : m_dest(dest), m_tag(tag), m_value(value) {}
+
+    bool start(const communicator& comm)
+    {
+      m_request = comm.isend(m_dest, m_tag, m_value);
+      return true;
+    }
+
+  private:
+    int m_dest;
+    int m_tag;
+    T   m_value;
+  };
+
+  template<typename T>
+  class recv_operation : public request_operation
+  {
+  public:
+    recv_operation(int source, int tag, T& value)
+      : m_source(source), m_tag(tag), m_value(value) {}
+
+    bool start(const communicator& comm)
+    {
+      m_request = comm.irecv(m_source, m_tag, m_value);
+      return true;
+    }
+
+  private:
+    int m_source;
+    int m_tag;
+    T&  m_value;
+  };
+
+  // Receive a value that the operation owns until it completes.
+  template<typename T>
+  class recv_value_operation : public submitted_operation
+  {
+  public:
+    recv_value_operation(int source, int tag) : m_source(source), m_tag(tag) {}
+
+    bool start(const communicator& comm)
+    {
+      m_request = comm.irecv(m_source, m_tag, m_value);
+      return true;
+    }
+
+    void finish(const status&) { m_promise.set_value(std::move(m_value)); }
+    void fail(std::exception_ptr e) { m_promise.set_exception(e); }
+
+    std::promise<T> m_promise;
+
+  private:
+    int m_source;
+    int m_tag;
+    T   m_value;
+  };
+
+#if BOOST_MPI_VERSION >= 3
+  class barrier_operation : public request_operation
+  {
+  public:
+    bool start(const communicator& comm)
+    {
+      m_request = request::make_ibarrier(comm);
+      return true;
+    }
+  };
+
+  template<typename T>
+  class broadcast_operation : public request_operation
+  {
+  public:
+    broadcast_operation(T* values, int n, int root)
+      : m_values(values), m_n(n), m_root(root) {}
+
+    bool start(const communicator& comm)
+    {
+      m_request = request::make_ibroadcast(comm, m_values, m_n, m_root);
+      return true;
+    }
+
+  private:
+    T*  m_values;
+    int m_n;
+    int m_root;
+  };
+
+  template<typename T>
+  class all_reduce_operation : public submitted_operation
+  {
+  public:
+    all_reduce_operation(const T& value, MPI_Op op) : m_in(value), m_op(op) {}
+
+    bool start(const communicator& comm)
+    {
+      m_request = request::make_iall_reduce(comm, &m_in, &m_out, 1, m_op);
+      return true;
+    }
+
+    void finish(const status&) { m_promise.set_value(m_out); }
+    void fail(std::exception_ptr e) { m_promise.set_exception(e); }
+
+    std::promise<T> m_promise;
+
+  private:
+    T      m_in;
+    T      m_out;
+    MPI_Op m_op;
+  };
+#endif // BOOST_MPI_VERSION >= 3
+
+  // Run a function in the owner thread.
+  template<typename F, typename R>
+  class function_operation : public submitted_operation
+  {
+  public:
+    explicit function_operation(F f) : m_function(std::move(f)) {}
+
+    bool start(const communicator& comm)
+    {
+      m_promise.set_value(m_function(comm));
+      return false;
+    }
+
+    void finish(const status&) {}
+    void fail(std::exception_ptr e) { m_promise.set_exception(e); }
+
+    std::promise<R> m_promise;
+
+  private:
+    F m_function;
+  };
+
+  template<typename F>
+  class function_operation<F, void> : public submitted_operation
+  {
+  public:
+    explicit function_operation(F f) : m_function(std::move(f)) {}
+
+    bool start(const communicator& comm)
+    {
+      m_function(comm);
+      m_promise.set_value();
+      return false;
+    }
+
+    void finish(const status&) {}
+    void fail(std::exception_ptr e) { m_promise.set_exception(e); }
+
+    std::promise<void> m_promise;
+
+  private:
+    F m_function;
+  };
+
+  // The blocking fallbacks of the collectives.
+  struct submitted_barrier
+  {
+    status operator()(const communicator& comm) const
+    {
+      comm.barrier();
+      return status();
+    }
+  };
+
+  template<typename T>
+  struct submitted_broadcast
+  {
+    status operator()(const communicator& comm) const
+    {
+      ::boost::mpi::broadcast(comm, values, n, root);
+      return status();
+    }
+    T*  values;
+    int n;
+    int root;
+  };
+
+  template<typename T, typename Op>
+  struct submitted_all_reduce
+  {
+    T operator()(const communicator& comm) const
+    {
+      return ::boost::mpi::all_reduce(comm, value, op);
+    }
+    T  value;
+    Op op;
+  };
+} // end namespace detail
+
+/**
+ * @brief Communications made on behalf of any thread by the single
+ * thread that owns MPI.
+ *
+ * With @c threading::funneled, only the main thread may call MPI, and
+ * with @c threading::serialized, only one thread at a time. A @c
+ * submission_queue lets the other threads communicate anyway: they
+ * submit sends, receives and collectives, which are pushed to a
+ * lock-free queue, and get a @c std::future for each. The owner
+ * thread takes the operations from the queue in order, starts them,
+ * tests all the pending requests at once, and completes the futures.
+ * This avoids both a mutex around every MPI call and @c
+ * threading::multiple, which is slower in many implementations.
+ *
+ * The owner is either the thread that calls @c poll() (the main
+ * thread, with @c threading::funneled), or a thread of the queue
+ * itself, launched by @c start() (which requires @c
+ * threading::serialized, and that no other thread calls MPI until @c
+ * stop()).
+ *
+ * The collectives on values with an MPI datatype use the non-blocking
+ * collectives of MPI 3; the others block the owner thread until they
+ * complete. As usual, all the processes of the communicator must
+ * submit the same collectives in the same order.
+ */
+class BOOST_MPI_DECL submission_queue
+{
+public:
+  /**
+   * Build a queue for the communications on @p comm.
+   */
+  explicit submission_queue(const communicator& comm)
+    : m_comm(comm), m_pending(0), m_stopping(false) {}
+
+  /**
+   * Complete all the submitted operations: stop the thread of the
+   * queue if it runs, otherwise poll until they have completed.
+   */
+  ~submission_queue();
+
+  /**
+   * The communicator of the operations.
+   */
+  const communicator& comm() const { return m_comm; }
+
+  /**
+   * Send a copy of @p value to @p dest.
+   */
+  template<typename T>
+  std::future<status> isend(int dest, int tag, const T& value)
+  {
+    return submit_operation(new detail::send_operation<T>(dest, tag, value));
+  }
+
+  /**
+   * Receive a value from @p source in @p value, which must remain
+   * until the future is ready.
+   */
+  template<typename T>
+  std::future<status> irecv(int source, int tag, T& value)
+  {
+    return submit_operation(new detail::recv_operation<T>(source, tag, value));
+  }
+
+  /**
+   * Receive a value from @p source, that the future gives.
+   */
+  template<typename T>
+  std::future<T> recv(int source, int tag)
+  {
+    return submit_operation(new detail::recv_value_operation<T>(source, tag));
+  }
+
+  /**
+   * Wait until all the processes have submitted the barrier.
+   */
+  std::future<status> barrier()
+  {
+#if BOOST_MPI_VERSION >= 3
+    return submit_operation(new detail::barrier_operation());
+#else
+    return submit(detail::submitted_barrier());
+#endif
+  }
+
+  /**
+   * Broadcast the @p n values at @p values from @p root. The values
+   * must remain until the future is ready.
+   */
+  template<typename T>
+  std::future<status> broadcast(T* values, int n, int root)
+  {
+    return broadcast_impl(values, n, root, mpl::bool_<is_mpi_datatype<T>::value>());
+  }
+
+  /**
+   * Combine the values of all the processes with @p op; the future
+   * gives the result.
+   */
+  template<typename T, typename Op>
+  std::future<T> all_reduce(const T& value, Op op)
+  {
+    return all_reduce_impl(value, op,
+                           mpl::bool_<is_mpi_datatype<T>::value
+                                      && is_mpi_op<Op, T>::value>());
+  }
+
+  /**
+   * Call @p f with the communicator in the owner thread, which may
+   * then make any communication. The future gives the result.
+   */
+  template<typename F>
+  std::future<typename std::result_of<F(const communicator&)>::type>
+  submit(F f)
+  {
+    typedef typename std::result_of<F(const communicator&)>::type result_type;
+    return submit_operation(new detail::function_operation<F, result_type>(std::move(f)));
+  }
+
+  /**
+   * In the owner thread, start the submitted operations, and test
+   * those in progress: the plain MPI requests with a single @c
+   * MPI_Testsome.
+   *
+   *   @returns The number of operations started or completed.
+   */
+  std::size_t poll();
+
+  /**
+   * The number of submitted operations that have not completed.
+   */
+  std::size_t pending() const { return m_pending.load(); }
+
+  /**
+   * Launch a thread that owns MPI and polls the queue until @c stop().
+   * MPI must have been initialized with @c threading::serialized at
+   * least, or an @c exception is thrown.
+   */
+  void start();
+
+  /**
+   * Complete the submitted operations, then end the thread launched
+   * by @c start(). Operations submitted after that are left to @c
+   * poll() or to another @c start().
+   */
+  void stop();
+
+private:
+  submission_queue(const submission_queue&);
+  submission_queue& operator=(const submission_queue&);
+
+  template<typename Operation>
+  auto submit_operation(Operation* op) -> decltype(op->m_promise.get_future())
+  {
+    auto result = op->m_promise.get_future();
+    ++m_pending;
+    m_queue.push(op);
+    return result;
+  }
+
+#if BOOST_MPI_VERSION >= 3
+  template<typename T>
+  std::future<status> broadcast_impl(T* values, int n, int root, mpl::true_)
+  {
+    return submit_operation(new detail::broadcast_operation<T>(values, n, root));
+  }
+
+  template<typename T, typename Op>
+  std::future<T> all_reduce_impl(const T& value, Op, mpl::true_)
+  {
+    return submit_operation(new detail::all_reduce_operation<T>(value,
+                                                                is_mpi_op<Op, T>::op()));
+  }
+#endif
+
+  template<typename T, typename IsMpiType>
+  std::future<status> broadcast_impl(T* values, int n, int root, IsMpiType)
+  {
+    detail::submitted_broadcast<T> f = { values, n, root };
+    return submit(f);
+  }
+
+  template<typename T, typename Op, typename IsMpiOp>
+  std::future<T> all_reduce_impl(const T& value, Op op, IsMpiOp)
+  {
+    detail::submitted_all_reduce<T, Op> f = { value, op };
+    return submit(f);
+  }
+
+  // The loop of the thread launched by start().
+  void run();
+
+  communicator                               m_comm;
+  detail::mpsc_queue                         m_queue;
+  std::vector<detail::submitted_operation*>  m_active;
+  std::atomic<std::size_t>                   m_pending;
+  std::atomic<bool>                          m_stopping;
+  std::thread                                m_thread;
+};
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_HAS_SUBMISSION_QUEUE
+
+#endif // BOOST_MPI_SUBMISSION_QUEUE_HPP
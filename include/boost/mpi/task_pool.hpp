@@ -0,0 +1,267 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file task_pool.hpp
+ *
+ *  This header defines the @c task_pool class template, which balances
+ *  tasks among processes by work stealing.
+ */
+#ifndef BOOST_MPI_TASK_POOL_HPP
+#define BOOST_MPI_TASK_POOL_HPP
+
+#include <boost/mpi/config.hpp>
+
+#if BOOST_MPI_VERSION >= 3
+
+#include <boost/mpi/active_messages.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/termination_detector.hpp>
+#include <boost/mpi/detail/node_hierarchy.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/serialization/vector.hpp>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+/**
+ * @brief How a @c task_pool chooses the process to steal from.
+ */
+enum steal_policy {
+  /** Any other process, at random. */
+  steal_random,
+  /** A process of the same shared memory node, at random, and after
+   *  each failed attempt there, any other process. */
+  steal_local_first
+};
+
+/**
+ * @brief Tasks balanced among processes by work stealing.
+ *
+ * Each process of a @c task_pool keeps its tasks in a deque, and
+ * executes the last one pushed first, so that a task spawning others
+ * works depth first. A process whose deque is empty asks another
+ * process, chosen according to the @c steal_policy, for tasks. That
+ * process sends it half of its own, rounded down, taken from the
+ * front of its deque, where the oldest, and usually largest, tasks
+ * are. The requests and the tasks travel as @c active_messages, the
+ * tasks serialized with a @c packed_oarchive, and @c run returns once
+ * a @c termination_detector has found that there are tasks neither in
+ * the deques nor in transit.
+ *
+ * The processes only answer requests between two tasks, every @c
+ * poll_interval tasks: short tasks should use a large interval, long
+ * tasks a small one.
+ */
+template<typename Task>
+class task_pool : noncopyable
+{
+public:
+  /**
+   * Build a pool over the processes of @p comm, which it duplicates.
+   * This is a collective operation.
+   */
+  explicit task_pool(const communicator& comm, steal_policy policy = steal_random,
+                     int poll_interval = 16)
+    : m_comm(comm, comm_duplicate), m_am(m_comm, 0, 0), m_poll_interval(poll_interval),
+      m_detector(0), m_waiting(false), m_last_local(false), m_last_failed(false),
+      m_random(m_comm.rank() * 2654435761u + 1), m_executed(0), m_steals(0),
+      m_stolen(0), m_given(0)
+  {
+    m_am.register_handler(steal_request, on_steal(this));
+    m_am.register_handler(steal_reply, on_reply(this));
+    if (policy == steal_local_first) {
+      detail::node_hierarchy h = detail::shared_memory_hierarchy(m_comm);
+      for (int p = 0; p < m_comm.size(); ++p) {
+        if (p != m_comm.rank()) {
+          (h.node_of[p] == h.node_of[m_comm.rank()] ? m_local : m_remote).push_back(p);
+        }
+      }
+    } else {
+      for (int p = 0; p < m_comm.size(); ++p) {
+        if (p != m_comm.rank()) {
+          m_remote.push_back(p);
+        }
+      }
+    }
+  }
+
+  /**
+   * Add a task to the deque of this process. Tasks executed by @c run
+   * may push others.
+   */
+  void push(const Task& task) { m_tasks.push_back(task); }
+
+  /**
+   * The number of tasks in the deque of this process.
+   */
+  std::size_t size() const { return m_tasks.size(); }
+
+  /**
+   * Execute the tasks of all the processes, calling @p execute(task)
+   * for each one on the process that holds it, until none is left.
+   * This is a collective operation.
+   */
+  template<typename Executor>
+  void run(Executor execute)
+  {
+    termination_detector detector(m_comm);
+    m_detector = &detector;
+    int since_progress = 0;
+    for (;;) {
+      if (!m_tasks.empty()) {
+        Task task = m_tasks.back();
+        m_tasks.pop_back();
+        execute(task);
+        ++m_executed;
+        if (++since_progress >= m_poll_interval) {
+          since_progress = 0;
+          m_am.progress();
+        }
+        continue;
+      }
+      if (!m_waiting) {
+        steal();
+      }
+      m_am.progress();
+      if (m_tasks.empty() && detector.test()) {
+        break;
+      }
+    }
+    // Requests for tasks may still be in transit: answer them until
+    // all the processes have had their answers.
+    while (m_waiting) {
+      m_am.progress();
+    }
+    request done = request::make_ibarrier(m_comm);
+    while (!done.test()) {
+      m_am.progress();
+    }
+    m_am.wait();
+    m_detector = 0;
+  }
+
+  /**
+   * The number of tasks executed by this process.
+   */
+  unsigned long executed() const { return m_executed; }
+
+  /**
+   * The number of requests for tasks this process has sent.
+   */
+  unsigned long steals() const { return m_steals; }
+
+  /**
+   * The number of tasks this process has received from others.
+   */
+  unsigned long stolen() const { return m_stolen; }
+
+  /**
+   * The number of tasks this process has sent to others.
+   */
+  unsigned long given() const { return m_given; }
+
+  /**
+   * The communicator of the pool.
+   */
+  const communicator& comm() const { return m_comm; }
+
+private:
+  enum { steal_request, steal_reply };
+
+  // Ask a process for tasks.
+  void steal()
+  {
+    // Go on with the processes of the node, unless that just failed.
+    bool local = !m_local.empty()
+      && (m_remote.empty() || !(m_last_local && m_last_failed));
+    std::vector<int>& victims = local ? m_local : m_remote;
+    if (victims.empty()) {
+      return;
+    }
+    m_am.post(victims[next_random() % victims.size()], steal_request);
+    m_last_local = local;
+    m_waiting = true;
+    ++m_steals;
+  }
+
+  // Send half the tasks to a process that asks.
+  struct on_steal
+  {
+    explicit on_steal(task_pool* pool) : pool(pool) {}
+
+    void operator()(int source, packed_iarchive&) const
+    {
+      std::size_t n = pool->m_tasks.size() / 2;
+      std::vector<Task> tasks(pool->m_tasks.begin(), pool->m_tasks.begin() + n);
+      pool->m_tasks.erase(pool->m_tasks.begin(), pool->m_tasks.begin() + n);
+      pool->m_am.post(source, steal_reply, tasks);
+      if (n > 0) {
+        // Only the messages carrying tasks are counted: the others
+        // cannot make a process busy again.
+        pool->m_detector->sent();
+        pool->m_given += n;
+      }
+    }
+
+    task_pool* pool;
+  };
+
+  // Receive the answer to a request.
+  struct on_reply
+  {
+    explicit on_reply(task_pool* pool) : pool(pool) {}
+
+    void operator()(int, packed_iarchive& ar) const
+    {
+      std::vector<Task> tasks;
+      ar >> tasks;
+      if (!tasks.empty()) {
+        pool->m_detector->received();
+        pool->m_stolen += tasks.size();
+        pool->m_tasks.insert(pool->m_tasks.end(), tasks.begin(), tasks.end());
+      }
+      pool->m_last_failed = tasks.empty();
+      pool->m_waiting = false;
+    }
+
+    task_pool* pool;
+  };
+
+  unsigned long next_random()
+  {
+    // xorshift: the victims need not be chosen very randomly.
+    m_random ^= m_random << 13;
+    m_random ^= m_random >> 17;
+    m_random ^= m_random << 5;
+    return m_random;
+  }
+
+  communicator           m_comm;
+  active_messages        m_am;
+  int                    m_poll_interval;
+  termination_detector*  m_detector;
+  std::deque<Task>       m_tasks;
+  std::vector<int>       m_local;
+  std::vector<int>       m_remote;
+  bool                   m_waiting;
+  bool                   m_last_local;
+  bool                   m_last_failed;
+  unsigned int           m_random;
+  unsigned long          m_executed;
+  unsigned long          m_steals;
+  unsigned long          m_stolen;
+  unsigned long          m_given;
+};
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_VERSION >= 3
+
+#endif // BOOST_MPI_TASK_POOL_HPP
@@ -0,0 +1,124 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file termination_detector.hpp
+ *
+ *  This header defines the @c termination_detector class, which finds
+ *  out, without blocking, when a computation driven by messages has
+ *  ended on all processes.
+ */
+#ifndef BOOST_MPI_TERMINATION_DETECTOR_HPP
+#define BOOST_MPI_TERMINATION_DETECTOR_HPP
+
+#include <boost/mpi/config.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  struct termination_state;
+}
+
+/**
+ * @brief Detects that a computation driven by messages has ended.
+ *
+ * In algorithms such as a distributed breadth-first search or a work
+ * queue, each process works on the messages it receives and sends
+ * new ones, and the computation ends when all the processes are idle
+ * and no message is in transit. The program counts the messages each
+ * process sends and receives with @c sent and @c received, and calls
+ * @c test whenever the process is idle, that is, when it has no more
+ * work until a message arrives.
+ *
+ * The detector then runs waves of non-blocking all-reduces of the
+ * counters, on a duplicate of the communicator. The computation has
+ * ended when two waves in a row find as many messages received as
+ * sent, with the same totals. A wave completes only when all the
+ * processes have been idle since the previous one, and costs one
+ * all-reduce, so that a busy computation is not slowed down. The
+ * processes all find out the end on the same wave. A detector is used
+ * for one computation.
+ *
+ * The request returned by @c get_request completes at the end of the
+ * computation. It can be waited for along with the receives of the
+ * process, with @c wait_any for instance, to sleep until either a
+ * message arrives or the computation has ended:
+ *
+ * @code
+ * request reqs[2] = { comm.irecv(any_source, 0, item), detector.get_request() };
+ * while (wait_any(reqs, reqs + 2).second == reqs) {
+ *   detector.received();
+ *   process(item); // may send, and call detector.sent()
+ *   reqs[0] = comm.irecv(any_source, 0, item);
+ * }
+ * @endcode
+ *
+ * Without MPI 3 non-blocking collectives, @c test blocks in each wave
+ * until all the processes have called it.
+ */
+class BOOST_MPI_DECL termination_detector
+{
+public:
+  /**
+   * Build a detector for the processes of @p comm, which it
+   * duplicates. This is a collective operation.
+   *
+   * When the last copy of the detector, or of its request, goes away
+   * before the end has been detected, it waits for the wave in
+   * flight, which completes once all the processes have tested in
+   * that wave.
+   */
+  explicit termination_detector(const communicator& comm);
+
+  /**
+   * Count @p n messages sent by this process.
+   */
+  void sent(unsigned long n = 1);
+
+  /**
+   * Count @p n messages received by this process.
+   */
+  void received(unsigned long n = 1);
+
+  /**
+   * Tell that this process is idle, and advance the detection.
+   *
+   *   @returns Whether the computation has ended.
+   */
+  bool test();
+
+  /**
+   * Wait until the computation has ended, while this process is idle.
+   * The other processes must not send it messages anymore.
+   */
+  void wait();
+
+  /**
+   * Whether the end of the computation has been detected.
+   */
+  bool terminated() const;
+
+  /**
+   * The number of waves completed so far.
+   */
+  unsigned long waves() const;
+
+  /**
+   * A request that completes at the end of the computation. Testing
+   * it, or waiting for it, tells that this process is idle.
+   */
+  const request& get_request() const { return m_request; }
+
+private:
+  shared_ptr<detail::termination_state> m_state;
+  request m_request;
+};
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_TERMINATION_DETECTOR_HPP
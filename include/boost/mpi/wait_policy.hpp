@@ -0,0 +1,136 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file wait_policy.hpp
+ *
+ *  This header defines how @c wait_any, @c wait_all and @c wait_some
+ *  wait for requests that MPI cannot wait for by itself, and the
+ *  counters of their polls.
+ */
+#ifndef BOOST_MPI_WAIT_POLICY_HPP
+#define BOOST_MPI_WAIT_POLICY_HPP
+
+#include <boost/mpi/config.hpp>
+
+namespace boost { namespace mpi {
+
+/**
+ * @brief What the @c wait_* functions do between two unsuccessful
+ * passes over their requests.
+ *
+ * When all the requests are plain MPI requests, the @c wait_*
+ * functions let MPI wait (@c MPI_Waitany and the like). Otherwise,
+ * for instance with receives of serialized data, they test the
+ * requests in turn until enough have completed, and the strategy
+ * tells what to do when a pass has completed none.
+ */
+enum wait_strategy {
+  /** Test again at once: the lowest latency, but a busy core. */
+  wait_spin,
+  /** Yield the processor to other threads before testing again. */
+  wait_yield,
+  /** Sleep, for one microsecond at first, then twice longer after
+   *  each pass, up to a maximum. */
+  wait_backoff,
+  /** Block in MPI until one of the plain MPI requests completes,
+   *  then test the other requests again. This is only done when the
+   *  other requests complete without being tested (see @c
+   *  request::progresses()) and, for @c wait_any and @c wait_some,
+   *  when there are none; otherwise, back off. */
+  wait_block
+};
+
+/**
+ * @brief A wait strategy and its parameters.
+ */
+struct wait_policy {
+  /** What to do after an unsuccessful pass. */
+  wait_strategy strategy;
+  /** The number of unsuccessful passes made at once, before the
+   *  strategy applies. */
+  int spins;
+  /** The longest sleep of @c wait_backoff, in microseconds. */
+  int max_sleep;
+
+  wait_policy(wait_strategy s = wait_spin, int sp = 0, int ms = 1000)
+    : strategy(s), spins(sp), max_sleep(ms) {}
+};
+
+/**
+ * The policy of the @c wait_* functions called without one. It is
+ * initially taken from the @c BOOST_MPI_WAIT_POLICY environment
+ * variable, which may be @c spin (the default), @c yield, @c backoff
+ * or @c block.
+ */
+BOOST_MPI_DECL wait_policy default_wait_policy();
+
+/**
+ * Change the policy of the @c wait_* functions called without one.
+ */
+BOOST_MPI_DECL void set_default_wait_policy(const wait_policy& policy);
+
+/**
+ * @brief Counters of the @c wait_* functions.
+ */
+struct wait_statistics {
+  /** The number of calls that made unsuccessful passes. */
+  unsigned long waits;
+  /** The number of unsuccessful passes over their requests. */
+  unsigned long polls;
+  /** The number of times they blocked in MPI, with @c wait_block. */
+  unsigned long blocks;
+};
+
+/**
+ * The counters of the @c wait_* functions since the start of the
+ * program, or the last @c reset_wait_statistics(). @c polls / @c
+ * waits is the average number of passes per completion.
+ */
+BOOST_MPI_DECL wait_statistics get_wait_statistics();
+
+/**
+ * Set the counters of the @c wait_* functions to zero.
+ */
+BOOST_MPI_DECL void reset_wait_statistics();
+
+namespace detail {
+  /**
+   * The wait of a call to a @c wait_* function that tests its
+   * requests in turn.
+   */
+  class BOOST_MPI_DECL waiter
+  {
+  public:
+    explicit waiter(const wait_policy& policy)
+      : m_policy(policy), m_polls(0), m_sleep(1) {}
+
+    ~waiter();
+
+    /**
+     * Wait after a pass that completed no request, as the policy says.
+     *
+     *   @param can_block Whether there are plain MPI requests to block
+     *   on, and blocking on them is safe.
+     *
+     *   @returns Whether the caller should block on them.
+     */
+    bool pause(bool can_block);
+
+    /**
+     * Whether the policy may block on the plain MPI requests.
+     */
+    bool may_block() const { return m_policy.strategy == wait_block; }
+
+  private:
+    wait_policy   m_policy;
+    unsigned long m_polls;
+    int           m_sleep;
+  };
+} // end namespace detail
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_WAIT_POLICY_HPP
@@ -0,0 +1,434 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+/** @file window.hpp
+ *
+ *  This header defines the @c window class template, through which
+ *  the processes of a communicator access each other's memory with
+ *  one-sided (remote memory access) operations, without the
+ *  participation of the target process.
+ */
+#ifndef BOOST_MPI_WINDOW_HPP
+#define BOOST_MPI_WINDOW_HPP
+
+#include <boost/mpi/config.hpp>
+
+#if BOOST_MPI_VERSION >= 3
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/operations.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/assert.hpp>
+#include <cstddef>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+  /**
+   * INTERNAL ONLY
+   *
+   * Frees an MPI window when the last Boost.MPI object referring to
+   * it goes away, unless MPI has already been finalized.
+   */
+  struct win_free
+  {
+    void operator()(MPI_Win* win) const
+    {
+      BOOST_ASSERT(win != 0);
+      int finalized;
+      BOOST_MPI_CHECK_RESULT(MPI_Finalized, (&finalized));
+      if (!finalized)
+        BOOST_MPI_CHECK_RESULT(MPI_Win_free, (win));
+      delete win;
+    }
+  };
+}
+
+/**
+ * @brief The kinds of passive target access epochs.
+ *
+ * A @c lock_shared epoch can be opened on a target by several
+ * origins at the same time, a @c lock_exclusive one cannot.
+ */
+enum lock_kind { lock_shared, lock_exclusive };
+
+/**
+ * @brief A window of memory accessible with one-sided operations.
+ *
+ * Every process of the communicator a @c window is built on exposes
+ * an array of @c T values, its part of the window, that the other
+ * processes can read and update with @c put, @c get, @c accumulate,
+ * @c fetch_and_op and @c compare_and_swap. Targets are designated by
+ * their rank in the communicator, and positions in their part of the
+ * window are counted in @c T values.
+ *
+ * @c T must have an associated MPI datatype (see @c
+ * is_mpi_datatype). Reductions are restricted to the operations that
+ * map to a predefined MPI operation (see @c is_mpi_op).
+ *
+ * The operations must be issued within an access epoch: either
+ * between two calls to @c fence() (active target synchronization),
+ * or between @c lock() and @c unlock(), or @c lock_all() and @c
+ * unlock_all() (passive target synchronization, which does not
+ * involve the target). They complete at the end of the epoch, or at
+ * the next @c flush(). Within a passive target epoch, @c rput and @c
+ * rget return a @c request that completes with the operation.
+ *
+ * Like communicators, @c window objects are handles: copies refer to
+ * the same MPI window, which is freed with the last copy.
+ */
+template<typename T>
+class window
+{
+  BOOST_MPL_ASSERT((is_mpi_datatype<T>));
+
+public:
+  /**
+   * Build an empty window, that does not refer to any MPI window.
+   */
+  window() : m_base(0), m_count(0) { }
+
+  /**
+   * Expose existing memory (@c MPI_Win_create). This is a collective
+   * operation over @p comm.
+   *
+   *   @param comm The communicator whose processes take part in the
+   *   window.
+   *
+   *   @param base The @p count values exposed by the calling process.
+   *   They must outlive the window.
+   *
+   *   @param count The number of values exposed by the calling
+   *   process. It can differ from process to process, and be zero.
+   */
+  window(const communicator& comm, T* base, std::size_t count);
+
+  /**
+   * Allocate the memory exposed by each process (@c
+   * MPI_Win_allocate), which lets MPI use memory suited to remote
+   * accesses. This is a collective operation over @p comm. The memory
+   * is freed with the window.
+   *
+   *   @param comm The communicator whose processes take part in the
+   *   window.
+   *
+   *   @param count The number of values allocated by the calling
+   *   process. It can differ from process to process, and be zero.
+   */
+  window(const communicator& comm, std::size_t count);
+
+  /**
+   * The communicator the window was built on.
+   */
+  const communicator& comm() const { return m_comm; }
+
+  /**
+   * The values exposed by the calling process.
+   */
+  T* data() const { return m_base; }
+
+  /**
+   * The number of values exposed by the calling process.
+   */
+  std::size_t size() const { return m_count; }
+
+  /**
+   * @brief Active target synchronization.
+   *
+   * Complete the operations of the previous epoch, if any, and start
+   * a new one. This is a collective operation over @c comm().
+   *
+   *   @param assert The @c MPI_MODE_* assertions for @c MPI_Win_fence.
+   */
+  void fence(int assert = 0) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_fence, (assert, *m_win));
+  }
+
+  /**
+   * Start a passive target access epoch on the part of the window of
+   * @p target.
+   *
+   *   @param kind Whether other processes may access @p target at
+   *   the same time.
+   *
+   *   @param assert The @c MPI_MODE_* assertions for @c MPI_Win_lock.
+   */
+  void lock(int target, lock_kind kind = lock_shared, int assert = 0) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_lock,
+                           (kind == lock_exclusive ? MPI_LOCK_EXCLUSIVE : MPI_LOCK_SHARED,
+                            target, assert, *m_win));
+  }
+
+  /**
+   * End the access epoch on @p target started by @c lock(), completing
+   * the operations issued on it.
+   */
+  void unlock(int target) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_unlock, (target, *m_win));
+  }
+
+  /**
+   * Start a shared passive target access epoch on all the processes.
+   *
+   *   @param assert The @c MPI_MODE_* assertions for @c
+   *   MPI_Win_lock_all.
+   */
+  void lock_all(int assert = 0) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_lock_all, (assert, *m_win));
+  }
+
+  /**
+   * End the access epoch started by @c lock_all().
+   */
+  void unlock_all() const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_unlock_all, (*m_win));
+  }
+
+  /**
+   * Complete, at the origin and at the target, the operations issued
+   * on @p target in the current passive target epoch.
+   */
+  void flush(int target) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_flush, (target, *m_win));
+  }
+
+  /**
+   * Complete the operations issued on all the targets in the current
+   * passive target epoch.
+   */
+  void flush_all() const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_flush_all, (*m_win));
+  }
+
+  /**
+   * Complete at the origin only the operations issued on @p target,
+   * so that their origin buffers can be reused.
+   */
+  void flush_local(int target) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_flush_local, (target, *m_win));
+  }
+
+  /**
+   * Complete at the origin only the operations issued on all the
+   * targets.
+   */
+  void flush_local_all() const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_flush_local_all, (*m_win));
+  }
+
+  /**
+   * Synchronize the public and private copies of the part of the
+   * window of the calling process, within a passive target epoch.
+   */
+  void sync() const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Win_sync, (*m_win));
+  }
+
+  /**
+   * Write @p n values to the part of the window of @p target, from
+   * position @p disp on.
+   */
+  void put(int target, std::size_t disp, const T* values, int n) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Put,
+                           (const_cast<T*>(values), n, get_mpi_datatype<T>(),
+                            target, MPI_Aint(disp), n, get_mpi_datatype<T>(), *m_win));
+  }
+
+  /**
+   * Write one value to the part of the window of @p target, at
+   * position @p disp.
+   */
+  void put(int target, std::size_t disp, const T& value) const
+  {
+    put(target, disp, &value, 1);
+  }
+
+  /**
+   * Read @p n values from the part of the window of @p target, from
+   * position @p disp on.
+   */
+  void get(int target, std::size_t disp, T* values, int n) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Get,
+                           (values, n, get_mpi_datatype<T>(),
+                            target, MPI_Aint(disp), n, get_mpi_datatype<T>(), *m_win));
+  }
+
+  /**
+   * Read one value from the part of the window of @p target, at
+   * position @p disp.
+   */
+  void get(int target, std::size_t disp, T& value) const
+  {
+    get(target, disp, &value, 1);
+  }
+
+  /**
+   * Like @c put, within a passive target epoch, with a request that
+   * completes when @p values can be reused.
+   */
+  request rput(int target, std::size_t disp, const T* values, int n) const
+  {
+    return request::make_trivial_put(*m_win, target, MPI_Aint(disp), values, n);
+  }
+
+  /**
+   * Like @c get, within a passive target epoch, with a request that
+   * completes when @p values have been read.
+   */
+  request rget(int target, std::size_t disp, T* values, int n) const
+  {
+    return request::make_trivial_get(*m_win, target, MPI_Aint(disp), values, n);
+  }
+
+  /**
+   * Combine @p n values with those of the part of the window of @p
+   * target, from position @p disp on: each target value @c y becomes
+   * @c op(y,x), @c x being the corresponding value of @p values. The
+   * updates are atomic with respect to the other accumulations.
+   *
+   *   @param op An operation for which @c is_mpi_op<Op,T> holds.
+   */
+  template<typename Op>
+  void accumulate(int target, std::size_t disp, const T* values, int n, Op op) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Accumulate,
+                           (const_cast<T*>(values), n, get_mpi_datatype<T>(),
+                            target, MPI_Aint(disp), n, get_mpi_datatype<T>(),
+                            mpi_op(op), *m_win));
+  }
+
+  /**
+   * Combine one value with that of the part of the window of @p
+   * target at position @p disp.
+   */
+  template<typename Op>
+  void accumulate(int target, std::size_t disp, const T& value, Op op) const
+  {
+    accumulate(target, disp, &value, 1, op);
+  }
+
+  /**
+   * Atomically combine @p value with the value of the part of the
+   * window of @p target at position @p disp, as @c accumulate does,
+   * and store the previous value in @p result once the operation has
+   * completed.
+   *
+   *   @param op An operation for which @c is_mpi_op<Op,T> holds.
+   */
+  template<typename Op>
+  void fetch_and_op(int target, std::size_t disp, const T& value, T& result, Op op) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Fetch_and_op,
+                           (const_cast<T*>(&value), &result, get_mpi_datatype<T>(),
+                            target, MPI_Aint(disp), mpi_op(op), *m_win));
+  }
+
+  /**
+   * Like the previous function, within a passive target epoch, and
+   * return the previous value, flushing the operation.
+   */
+  template<typename Op>
+  T fetch_and_op(int target, std::size_t disp, const T& value, Op op) const
+  {
+    T result;
+    fetch_and_op(target, disp, value, result, op);
+    flush(target);
+    return result;
+  }
+
+  /**
+   * Atomically replace the value of the part of the window of @p
+   * target at position @p disp by @p value if it is equal to @p
+   * compare, and store the previous value in @p result once the
+   * operation has completed.
+   */
+  void compare_and_swap(int target, std::size_t disp, const T& value, const T& compare,
+                        T& result) const
+  {
+    BOOST_MPI_CHECK_RESULT(MPI_Compare_and_swap,
+                           (const_cast<T*>(&value), const_cast<T*>(&compare), &result,
+                            get_mpi_datatype<T>(), target, MPI_Aint(disp), *m_win));
+  }
+
+  /**
+   * Like the previous function, within a passive target epoch, and
+   * return the previous value, flushing the operation.
+   */
+  T compare_and_swap(int target, std::size_t disp, const T& value, const T& compare) const
+  {
+    T result;
+    compare_and_swap(target, disp, value, compare, result);
+    flush(target);
+    return result;
+  }
+
+  /**
+   * Access the underlying MPI window.
+   */
+  operator MPI_Win() const { return m_win ? *m_win : MPI_WIN_NULL; }
+
+  /**
+   * Determine whether this object refers to an MPI window.
+   */
+  operator bool() const { return bool(m_win); }
+
+private:
+  template<typename Op>
+  static MPI_Op mpi_op(Op)
+  {
+    BOOST_MPL_ASSERT((is_mpi_op<Op, T>));
+    return is_mpi_op<Op, T>::op();
+  }
+
+  communicator        m_comm;
+  shared_ptr<MPI_Win> m_win;
+  T*                  m_base;
+  std::size_t         m_count;
+};
+
+template<typename T>
+window<T>::window(const communicator& comm, T* base, std::size_t count)
+  : m_comm(comm), m_base(base), m_count(count)
+{
+  MPI_Win win;
+  BOOST_MPI_CHECK_RESULT(MPI_Win_create,
+                         (base, MPI_Aint(count * sizeof(T)), int(sizeof(T)),
+                          MPI_INFO_NULL, MPI_Comm(comm), &win));
+  m_win.reset(new MPI_Win(win), detail::win_free());
+}
+
+template<typename T>
+window<T>::window(const communicator& comm, std::size_t count)
+  : m_comm(comm), m_base(0), m_count(count)
+{
+  MPI_Win win;
+  BOOST_MPI_CHECK_RESULT(MPI_Win_allocate,
+                         (MPI_Aint(count * sizeof(T)), int(sizeof(T)),
+                          MPI_INFO_NULL, MPI_Comm(comm), &m_base, &win));
+  m_win.reset(new MPI_Win(win), detail::win_free());
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_VERSION >= 3
+
+#endif // BOOST_MPI_WINDOW_HPP
@@ -0,0 +1,122 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpi/active_messages.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/status.hpp>
+#include <boost/assert.hpp>
+
+namespace boost { namespace mpi {
+
+active_messages::~active_messages()
+{
+  wait();
+}
+
+void
+active_messages::flush(int dest)
+{
+  if (m_batches[dest].count() > 0) {
+    m_sends.push_back(m_batches[dest].post(m_comm, dest, m_tag));
+  }
+}
+
+void
+active_messages::flush()
+{
+  for (int dest = 0; dest < int(m_batches.size()); ++dest) {
+    flush(dest);
+  }
+}
+
+std::size_t
+active_messages::progress()
+{
+  flush();
+  reap();
+  std::size_t handled = 0;
+  for (;;) {
+    packed_iarchive ar(m_comm);
+#if defined(BOOST_MPI_USE_IMPROBE)
+    int flag = 0;
+    MPI_Message msg;
+    MPI_Status stat;
+    BOOST_MPI_CHECK_RESULT(MPI_Improbe,
+                           (MPI_ANY_SOURCE, m_tag, m_comm, &flag, &msg, &stat));
+    if (!flag) {
+      break;
+    }
+    int count;
+    BOOST_MPI_CHECK_RESULT(MPI_Get_count, (&stat, MPI_PACKED, &count));
+    ar.resize(count);
+    BOOST_MPI_CHECK_RESULT(MPI_Mrecv, (ar.address(), count, MPI_PACKED, &msg, &stat));
+    int source = stat.MPI_SOURCE;
+#else
+    optional<status> probed = m_comm.iprobe(any_source, m_tag);
+    if (!probed) {
+      break;
+    }
+    int source = probed->source();
+    m_comm.recv(source, m_tag, ar);
+#endif
+    handled += dispatch(source, ar);
+  }
+  return handled;
+}
+
+std::size_t
+active_messages::dispatch(int source, packed_iarchive& ar)
+{
+  int n;
+  ar >> n;
+  for (int i = 0; i < n; ++i) {
+    int id;
+    ar >> id;
+    std::map<int, handler>::iterator h = m_handlers.find(id);
+    BOOST_ASSERT_MSG(h != m_handlers.end(), "no handler registered with this id");
+    if (h == m_handlers.end()) {
+      // The rest of the batch cannot be read.
+      return i;
+    }
+    ++m_handled;
+    h->second(source, ar);
+  }
+  return n;
+}
+
+void
+active_messages::wait()
+{
+  for (std::size_t i = 0; i < m_sends.size(); ++i) {
+    m_sends[i].wait();
+  }
+  m_sends.clear();
+}
+
+void
+active_messages::reap()
+{
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < m_sends.size(); ++i) {
+    if (!m_sends[i].test()) {
+      if (kept != i) {
+        m_sends[kept] = m_sends[i];
+      }
+      ++kept;
+    }
+  }
+  m_sends.resize(kept);
+}
+
+int
+active_messages::handler_id(const std::type_info& type) const
+{
+  type_map::const_iterator t = m_types.find(&type);
+  BOOST_ASSERT_MSG(t != m_types.end(), "no handler registered with this type");
+  return t == m_types.end() ? -1 : t->second;
+}
+
+} } // end namespace boost::mpi
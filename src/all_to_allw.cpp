@@ -0,0 +1,61 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 2.0 -- Section 4.8. All-to-All (w variant)
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/skeleton_and_content_types.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/assert.hpp>
+
+namespace boost { namespace mpi {
+
+void
+all_to_allw(const communicator& comm,
+            const void* in_buffer, const std::vector<int>& in_sizes,
+            const std::vector<int>& in_displs, const std::vector<MPI_Datatype>& in_types,
+            void* out_buffer, const std::vector<int>& out_sizes,
+            const std::vector<int>& out_displs, const std::vector<MPI_Datatype>& out_types)
+{
+  using detail::c_data;
+  BOOST_ASSERT(int(in_sizes.size()) == comm.size());
+  BOOST_ASSERT(int(in_displs.size()) == comm.size());
+  BOOST_ASSERT(int(in_types.size()) == comm.size());
+  BOOST_ASSERT(int(out_sizes.size()) == comm.size());
+  BOOST_ASSERT(int(out_displs.size()) == comm.size());
+  BOOST_ASSERT(int(out_types.size()) == comm.size());
+  BOOST_MPI_CHECK_RESULT(MPI_Alltoallw,
+                         (const_cast<void*>(in_buffer),
+                          const_cast<int*>(c_data(in_sizes)),
+                          const_cast<int*>(c_data(in_displs)),
+                          const_cast<MPI_Datatype*>(c_data(in_types)),
+                          out_buffer,
+                          const_cast<int*>(c_data(out_sizes)),
+                          const_cast<int*>(c_data(out_displs)),
+                          const_cast<MPI_Datatype*>(c_data(out_types)),
+                          comm));
+}
+
+void
+all_to_allw(const communicator& comm, const std::vector<content>& in_values,
+            const std::vector<content>& out_values)
+{
+  int size = comm.size();
+  BOOST_ASSERT(int(in_values.size()) == size);
+  BOOST_ASSERT(int(out_values.size()) == size);
+  std::vector<int> in_sizes(size, 1);
+  std::vector<int> out_sizes(size, 1);
+  std::vector<int> displs(size, 0);
+  std::vector<MPI_Datatype> in_types(size);
+  std::vector<MPI_Datatype> out_types(size);
+  for (int p = 0; p < size; ++p) {
+    in_types[p]  = in_values[p].get_mpi_datatype();
+    out_types[p] = out_values[p].get_mpi_datatype();
+  }
+  ::boost::mpi::all_to_allw(comm, MPI_BOTTOM, in_sizes, displs, in_types,
+                            MPI_BOTTOM, out_sizes, displs, out_types);
+}
+
+} } // end namespace boost::mpi
@@ -0,0 +1,287 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 1.1 -- Section 4.5. Gather, and
+// Section 4.6. Scatter
+#include <boost/mpi/collective_plan.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/mpi/detail/offsets.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/exception.hpp>
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace boost { namespace mpi {
+
+using detail::c_data;
+
+namespace {
+// The collectives a plan can be made for.
+enum plan_kind { no_plan, all_gather_plan, gather_plan, scatter_plan };
+
+// The size prefix of each slot.
+int const prefix = int(sizeof(int));
+
+// Fill a slot with the size of the data and its first bytes.
+void
+fill_slot(int slot, const void* data, int size, char* result)
+{
+  std::memcpy(result, &size, prefix);
+  std::memcpy(result + prefix, data, std::min(size, slot - prefix));
+}
+
+// Read back the sizes from the slots of all the processes, and tell
+// whether the data of all of them fit.
+bool
+read_sizes(const std::vector<char, allocator<char> >& slots,
+           const std::vector<int>& slot_sizes, const std::vector<int>& slot_offsets,
+           std::vector<int>& sizes)
+{
+  bool fit = true;
+  sizes.resize(slot_sizes.size());
+  for (std::size_t p = 0; p < sizes.size(); ++p) {
+    std::memcpy(&sizes[p], c_data(slots) + slot_offsets[p], prefix);
+    fit = fit && sizes[p] <= slot_sizes[p] - prefix;
+  }
+  return fit;
+}
+
+// Move the data out of the slots into a contiguous buffer, and
+// compute, for each process, the number of bytes of its data that are
+// still missing and where they go.
+void
+unpack_slots(const std::vector<char, allocator<char> >& slots,
+             const std::vector<int>& slot_sizes, const std::vector<int>& slot_offsets,
+             const std::vector<int>& sizes, std::vector<char, allocator<char> >& buffer,
+             std::vector<int>& offsets, std::vector<int>& rests,
+             std::vector<int>& rest_offsets)
+{
+  int nproc = int(sizes.size());
+  offsets.resize(nproc);
+  detail::sizes2offsets(sizes, offsets);
+  buffer.resize(std::accumulate(sizes.begin(), sizes.end(), 0));
+  rests.resize(nproc);
+  rest_offsets.resize(nproc);
+  for (int p = 0; p < nproc; ++p) {
+    int inlined = std::min(sizes[p], slot_sizes[p] - prefix);
+    std::memcpy(c_data(buffer) + offsets[p], c_data(slots) + slot_offsets[p] + prefix, inlined);
+    rests[p] = sizes[p] - inlined;
+    rest_offsets[p] = offsets[p] + inlined;
+  }
+}
+} // end anonymous namespace
+
+collective_plan::collective_plan(const communicator& comm)
+  : m_comm(comm), m_kind(no_plan), m_root(-1), m_single_round(false)
+{
+}
+
+void collective_plan::reset()
+{
+  m_kind = no_plan;
+  m_slots.clear();
+  m_slot_offsets.clear();
+}
+
+void collective_plan::prepare(int kind, int root)
+{
+  if (kind != m_kind || root != m_root || m_slots.empty()) {
+    // Slots that only hold the sizes: the first call exchanges them,
+    // then the data.
+    m_kind = kind;
+    m_root = root;
+    m_slots.assign(m_comm.size(), prefix);
+    update_offsets();
+  }
+}
+
+void collective_plan::grow(int p, int size)
+{
+  m_slots[p] = std::max(m_slots[p], size + prefix);
+}
+
+void collective_plan::update_offsets()
+{
+  m_slot_offsets.resize(m_slots.size());
+  detail::sizes2offsets(m_slots, m_slot_offsets);
+}
+
+void
+collective_plan::all_gather(const void* data, int size,
+                            std::vector<char, allocator<char> >& buffer,
+                            std::vector<int>& sizes, std::vector<int>& offsets)
+{
+  prepare(all_gather_plan, -1);
+  int nproc = m_comm.size();
+  int rank = m_comm.rank();
+
+  std::vector<char> mine(m_slots[rank]);
+  fill_slot(m_slots[rank], data, size, c_data(mine));
+  std::vector<char, allocator<char> > slots(m_slot_offsets[nproc-1] + m_slots[nproc-1]);
+  BOOST_MPI_CHECK_RESULT(MPI_Allgatherv,
+                         (c_data(mine), m_slots[rank], MPI_BYTE,
+                          c_data(slots), c_data(m_slots), c_data(m_slot_offsets),
+                          MPI_BYTE, MPI_Comm(m_comm)));
+  m_single_round = read_sizes(slots, m_slots, m_slot_offsets, sizes);
+  if (m_single_round) {
+    // Use the data where it is.
+    offsets.resize(nproc);
+    for (int p = 0; p < nproc; ++p) {
+      offsets[p] = m_slot_offsets[p] + prefix;
+    }
+    buffer.swap(slots);
+    return;
+  }
+
+  // Everybody knows whose data did not fit, and sends or receives the
+  // rest of it.
+  std::vector<int> rests;
+  std::vector<int> rest_offsets;
+  unpack_slots(slots, m_slots, m_slot_offsets, sizes, buffer, offsets, rests, rest_offsets);
+  BOOST_MPI_CHECK_RESULT(MPI_Allgatherv,
+                         (static_cast<char*>(const_cast<void*>(data)) + size - rests[rank],
+                          rests[rank], MPI_BYTE,
+                          c_data(buffer), c_data(rests), c_data(rest_offsets),
+                          MPI_BYTE, MPI_Comm(m_comm)));
+  for (int p = 0; p < nproc; ++p) {
+    grow(p, sizes[p]);
+  }
+  update_offsets();
+}
+
+void
+collective_plan::gather(int root, const void* data, int size,
+                        std::vector<char, allocator<char> >& buffer,
+                        std::vector<int>& sizes, std::vector<int>& offsets)
+{
+  prepare(gather_plan, root);
+  int nproc = m_comm.size();
+  int rank = m_comm.rank();
+  bool is_root = rank == root;
+  int tag = environment::collectives_tag();
+
+  std::vector<char> mine(m_slots[rank]);
+  fill_slot(m_slots[rank], data, size, c_data(mine));
+  std::vector<char, allocator<char> > slots(is_root ? m_slot_offsets[nproc-1] + m_slots[nproc-1] : 0);
+  BOOST_MPI_CHECK_RESULT(MPI_Gatherv,
+                         (c_data(mine), m_slots[rank], MPI_BYTE,
+                          c_data(slots), c_data(m_slots), c_data(m_slot_offsets),
+                          MPI_BYTE, root, MPI_Comm(m_comm)));
+  if (!is_root) {
+    int room = m_slots[rank] - prefix;
+    m_single_round = size <= room;
+    if (!m_single_round) {
+      BOOST_MPI_CHECK_RESULT(MPI_Send,
+                             (static_cast<char*>(const_cast<void*>(data)) + room,
+                              size - room, MPI_BYTE, root, tag, MPI_Comm(m_comm)));
+      grow(rank, size);
+      update_offsets();
+    }
+    return;
+  }
+
+  m_single_round = read_sizes(slots, m_slots, m_slot_offsets, sizes);
+  if (m_single_round) {
+    offsets.resize(nproc);
+    for (int p = 0; p < nproc; ++p) {
+      offsets[p] = m_slot_offsets[p] + prefix;
+    }
+    buffer.swap(slots);
+    return;
+  }
+
+  std::vector<int> rests;
+  std::vector<int> rest_offsets;
+  unpack_slots(slots, m_slots, m_slot_offsets, sizes, buffer, offsets, rests, rest_offsets);
+  for (int p = 0; p < nproc; ++p) {
+    if (rests[p] == 0) {
+      continue;
+    }
+    if (p == root) {
+      std::memcpy(c_data(buffer) + rest_offsets[p],
+                  static_cast<const char*>(data) + size - rests[p], rests[p]);
+    } else {
+      BOOST_MPI_CHECK_RESULT(MPI_Recv,
+                             (c_data(buffer) + rest_offsets[p], rests[p], MPI_BYTE,
+                              p, tag, MPI_Comm(m_comm), MPI_STATUS_IGNORE));
+    }
+    grow(p, sizes[p]);
+  }
+  update_offsets();
+}
+
+void
+collective_plan::scatter(int root, const std::vector<char, allocator<char> >& data,
+                         const std::vector<int>& sizes,
+                         std::vector<char, allocator<char> >& received)
+{
+  prepare(scatter_plan, root);
+  int nproc = m_comm.size();
+  int rank = m_comm.rank();
+  bool is_root = rank == root;
+  int tag = environment::collectives_tag();
+
+  std::vector<int> offsets;
+  std::vector<char, allocator<char> > slots;
+  if (is_root) {
+    offsets.resize(nproc);
+    detail::sizes2offsets(sizes, offsets);
+    slots.resize(m_slot_offsets[nproc-1] + m_slots[nproc-1]);
+    for (int p = 0; p < nproc; ++p) {
+      fill_slot(m_slots[p], c_data(data) + offsets[p], sizes[p],
+                c_data(slots) + m_slot_offsets[p]);
+    }
+  }
+  std::vector<char> mine(m_slots[rank]);
+  BOOST_MPI_CHECK_RESULT(MPI_Scatterv,
+                         (c_data(slots), c_data(m_slots), c_data(m_slot_offsets), MPI_BYTE,
+                          c_data(mine), m_slots[rank], MPI_BYTE, root, MPI_Comm(m_comm)));
+  int size;
+  std::memcpy(&size, c_data(mine), prefix);
+  int room = m_slots[rank] - prefix;
+  received.resize(size);
+  std::memcpy(c_data(received), c_data(mine) + prefix, std::min(size, room));
+
+  if (is_root) {
+    // Send the rest of the data that did not fit.
+    m_single_round = true;
+    std::vector<MPI_Request> requests;
+    requests.reserve(nproc);
+    for (int p = 0; p < nproc; ++p) {
+      int p_room = m_slots[p] - prefix;
+      if (sizes[p] <= p_room) {
+        continue;
+      }
+      m_single_round = false;
+      const char* rest = c_data(data) + offsets[p] + p_room;
+      if (p == root) {
+        std::memcpy(c_data(received) + room, rest, size - room);
+      } else {
+        requests.push_back(MPI_REQUEST_NULL);
+        BOOST_MPI_CHECK_RESULT(MPI_Isend,
+                               (const_cast<char*>(rest), sizes[p] - p_room, MPI_BYTE,
+                                p, tag, MPI_Comm(m_comm), &requests.back()));
+      }
+      grow(p, sizes[p]);
+    }
+    BOOST_MPI_CHECK_RESULT(MPI_Waitall,
+                           (int(requests.size()), c_data(requests), MPI_STATUSES_IGNORE));
+  } else {
+    m_single_round = size <= room;
+    if (!m_single_round) {
+      BOOST_MPI_CHECK_RESULT(MPI_Recv,
+                             (c_data(received) + room, size - room, MPI_BYTE,
+                              root, tag, MPI_Comm(m_comm), MPI_STATUS_IGNORE));
+      grow(rank, size);
+    }
+  }
+  if (!m_single_round) {
+    update_offsets();
+  }
+}
+
+} } // end namespace boost::mpi
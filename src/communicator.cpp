@@ -8,6 +8,7 @@
 #include <boost/mpi/intercommunicator.hpp>
 #include <boost/mpi/graph_communicator.hpp>
 #include <boost/mpi/cartesian_communicator.hpp>
+#include <boost/mpi/dist_graph_communicator.hpp>
 #include <boost/mpi/skeleton_and_content.hpp>
 #include <boost/mpi/detail/point_to_point.hpp>
 
@@ -189,6 +190,29 @@ optional<cartesian_communicator> communicator::as_cartesian_communicator() const
   }
 }
 
+#if BOOST_MPI_VERSION >= 3
+bool communicator::has_dist_graph_topology() const
+{
+  bool is_dist_graph = false;
+  // topology test not allowed on MPI_NULL_COMM
+  if (bool(*this)) {
+    int status;
+    BOOST_MPI_CHECK_RESULT(MPI_Topo_test, ((MPI_Comm)*this, &status));
+    is_dist_graph = status == MPI_DIST_GRAPH;
+  }
+  return is_dist_graph;
+}
+
+optional<dist_graph_communicator> communicator::as_dist_graph_communicator() const
+{
+  if (has_dist_graph_topology()) {
+    return dist_graph_communicator(comm_ptr);
+  } else {
+    return optional<dist_graph_communicator>();
+  }
+}
+#endif
+
 void communicator::abort(int errcode) const
 {
   BOOST_MPI_CHECK_RESULT(MPI_Abort, (MPI_Comm(*this), errcode));
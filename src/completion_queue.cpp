@@ -0,0 +1,108 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpi/completion_queue.hpp>
+#include <boost/mpi/detail/test_batch.hpp>
+
+namespace boost { namespace mpi {
+
+void
+completion_queue::push(const request& r)
+{
+  if (r.active()) {
+    m_pending.push_back(r);
+  } else {
+    m_completed.push_back(std::make_pair(r, status()));
+  }
+}
+
+void
+completion_queue::collect()
+{
+  std::size_t n = m_pending.size();
+  if (n == 0) {
+    return;
+  }
+  // A request completed through another copy of it is no longer
+  // active: it is done, as in push().
+  std::vector<bool> finished(n, false);
+  bool any = false;
+  m_pointers.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    m_pointers[i] = &m_pending[i];
+    if (!m_pending[i].active()) {
+      finished[i] = any = true;
+      m_completed.push_back(std::make_pair(m_pending[i], status()));
+    }
+  }
+  m_done.clear();
+  detail::test_batch(&m_pointers[0], int(n), m_done);
+  if (m_done.empty() && !any) {
+    return;
+  }
+  // Move the completed requests out, keeping the others in order.
+  for (std::size_t k = 0; k < m_done.size(); ++k) {
+    int i = m_done[k].first;
+    finished[i] = true;
+    m_completed.push_back(std::make_pair(m_pending[i], m_done[k].second));
+  }
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!finished[i]) {
+      if (kept != i) {
+        m_pending[kept] = m_pending[i];
+      }
+      ++kept;
+    }
+  }
+  m_pending.resize(kept);
+}
+
+std::size_t
+completion_queue::run_completed()
+{
+  // Continuations may complete requests of their own: those wait for
+  // the next call.
+  std::size_t n = m_completed.size();
+  for (std::size_t k = 0; k < n; ++k) {
+    std::pair<request, status> c = m_completed.front();
+    m_completed.pop_front();
+    if (c.first.m_continuation) {
+      c.first.m_continuation(c.second);
+    }
+  }
+  return n;
+}
+
+std::size_t
+completion_queue::poll()
+{
+  collect();
+  return run_completed();
+}
+
+std::size_t
+completion_queue::wait_some()
+{
+  while (!empty()) {
+    if (std::size_t n = poll()) {
+      return n;
+    }
+  }
+  return 0;
+}
+
+std::size_t
+completion_queue::run()
+{
+  std::size_t total = 0;
+  while (!empty()) {
+    total += wait_some();
+  }
+  return total;
+}
+
+} } // end namespace boost::mpi
@@ -0,0 +1,210 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 2.2 -- Section 7.5.4. Distributed Graph Constructor
+#include <boost/mpi/dist_graph_communicator.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+
+#if BOOST_MPI_VERSION >= 3
+
+namespace boost { namespace mpi {
+
+namespace detail {
+
+// MPI does not accept a null weight array, even for an empty
+// neighborhood, when the topology is weighted.
+static int*
+weights_ptr(std::vector<int> const& weights)
+{
+  return (weights.empty()
+          ? MPI_WEIGHTS_EMPTY
+          : const_cast<int*>(c_data(weights)));
+}
+
+void
+neighbor_counts(communicator const& comm, int& indegree, int& outdegree)
+{
+  int status;
+  BOOST_MPI_CHECK_RESULT(MPI_Topo_test, ((MPI_Comm)comm, &status));
+  switch (status) {
+  case MPI_CART:
+    {
+      int ndims;
+      BOOST_MPI_CHECK_RESULT(MPI_Cartdim_get, ((MPI_Comm)comm, &ndims));
+      indegree = outdegree = 2*ndims;
+      break;
+    }
+  case MPI_GRAPH:
+    {
+      int nneighbors;
+      BOOST_MPI_CHECK_RESULT(MPI_Graph_neighbors_count,
+                             ((MPI_Comm)comm, comm.rank(), &nneighbors));
+      indegree = outdegree = nneighbors;
+      break;
+    }
+  case MPI_DIST_GRAPH:
+    {
+      int weighted;
+      BOOST_MPI_CHECK_RESULT(MPI_Dist_graph_neighbors_count,
+                             ((MPI_Comm)comm, &indegree, &outdegree, &weighted));
+      break;
+    }
+  default:
+    // Neighborhood collectives require a process topology.
+    boost::throw_exception(exception("MPI_Topo_test", MPI_ERR_TOPOLOGY));
+  }
+}
+
+} // end namespace detail
+
+dist_graph_communicator::dist_graph_communicator(const shared_ptr<MPI_Comm>& comm_ptr)
+{
+  this->comm_ptr = comm_ptr;
+  BOOST_ASSERT(has_dist_graph_topology());
+  fetch_adjacency();
+}
+
+dist_graph_communicator::dist_graph_communicator(const MPI_Comm& comm,
+                                                 comm_create_kind kind)
+  : communicator(comm, kind)
+{
+  BOOST_ASSERT(!bool(*this) || has_dist_graph_topology());
+  fetch_adjacency();
+}
+
+dist_graph_communicator::dist_graph_communicator(const communicator& comm,
+                                                 const std::vector<int>& sources,
+                                                 const std::vector<int>& destinations,
+                                                 bool reorder)
+{
+  setup_dist_graph(comm, sources, MPI_UNWEIGHTED, destinations, MPI_UNWEIGHTED,
+                   reorder);
+}
+
+dist_graph_communicator::dist_graph_communicator(const communicator& comm,
+                                                 const std::vector<int>& sources,
+                                                 const std::vector<int>& source_weights,
+                                                 const std::vector<int>& destinations,
+                                                 const std::vector<int>& destination_weights,
+                                                 bool reorder)
+{
+  BOOST_ASSERT(sources.size() == source_weights.size());
+  BOOST_ASSERT(destinations.size() == destination_weights.size());
+  setup_dist_graph(comm,
+                   sources, detail::weights_ptr(source_weights),
+                   destinations, detail::weights_ptr(destination_weights),
+                   reorder);
+}
+
+void
+dist_graph_communicator::setup_dist_graph(const communicator& comm,
+                                          const std::vector<int>& sources,
+                                          const int* source_weights,
+                                          const std::vector<int>& destinations,
+                                          const int* destination_weights,
+                                          bool reorder)
+{
+  using detail::c_data;
+
+  MPI_Comm newcomm;
+  BOOST_MPI_CHECK_RESULT(MPI_Dist_graph_create_adjacent,
+                         ((MPI_Comm)comm,
+                          int(sources.size()),
+                          const_cast<int*>(c_data(sources)),
+                          const_cast<int*>(source_weights),
+                          int(destinations.size()),
+                          const_cast<int*>(c_data(destinations)),
+                          const_cast<int*>(destination_weights),
+                          MPI_INFO_NULL,
+                          reorder,
+                          &newcomm));
+  this->comm_ptr.reset(new MPI_Comm(newcomm), comm_free());
+  fetch_adjacency();
+}
+
+void
+dist_graph_communicator::fetch_adjacency()
+{
+  using detail::c_data;
+
+  shared_ptr<detail::dist_graph_adjacency> adjacency(new detail::dist_graph_adjacency);
+  adjacency->weighted = false;
+  if (bool(*this)) {
+    int indegree, outdegree, weighted;
+    BOOST_MPI_CHECK_RESULT(MPI_Dist_graph_neighbors_count,
+                           ((MPI_Comm)*this, &indegree, &outdegree, &weighted));
+    adjacency->weighted = weighted != 0;
+    adjacency->sources.resize(indegree);
+    adjacency->destinations.resize(outdegree);
+    if (adjacency->weighted) {
+      adjacency->source_weights.resize(indegree);
+      adjacency->destination_weights.resize(outdegree);
+    }
+    BOOST_MPI_CHECK_RESULT(MPI_Dist_graph_neighbors,
+                           ((MPI_Comm)*this,
+                            indegree, c_data(adjacency->sources),
+                            (adjacency->weighted
+                             ? c_data(adjacency->source_weights)
+                             : MPI_UNWEIGHTED),
+                            outdegree, c_data(adjacency->destinations),
+                            (adjacency->weighted
+                             ? c_data(adjacency->destination_weights)
+                             : MPI_UNWEIGHTED)));
+  }
+  m_adjacency = adjacency;
+}
+
+// Incidence Graph requirements
+std::pair<detail::dist_graph_edge_iterator, detail::dist_graph_edge_iterator>
+out_edges(int vertex, const dist_graph_communicator& comm)
+{
+  BOOST_ASSERT(vertex == comm.rank());
+  const int* first = detail::c_data(comm.destinations());
+  return std::make_pair(detail::dist_graph_edge_iterator(vertex, first, true),
+                        detail::dist_graph_edge_iterator(vertex, first + comm.out_degree(),
+                                                         true));
+}
+
+int out_degree(int vertex, const dist_graph_communicator& comm)
+{
+  BOOST_ASSERT(vertex == comm.rank());
+  return comm.out_degree();
+}
+
+// Bidirectional Graph requirements
+std::pair<detail::dist_graph_edge_iterator, detail::dist_graph_edge_iterator>
+in_edges(int vertex, const dist_graph_communicator& comm)
+{
+  BOOST_ASSERT(vertex == comm.rank());
+  const int* first = detail::c_data(comm.sources());
+  return std::make_pair(detail::dist_graph_edge_iterator(vertex, first, false),
+                        detail::dist_graph_edge_iterator(vertex, first + comm.in_degree(),
+                                                         false));
+}
+
+int in_degree(int vertex, const dist_graph_communicator& comm)
+{
+  BOOST_ASSERT(vertex == comm.rank());
+  return comm.in_degree();
+}
+
+int degree(int vertex, const dist_graph_communicator& comm)
+{
+  BOOST_ASSERT(vertex == comm.rank());
+  return comm.in_degree() + comm.out_degree();
+}
+
+// Adjacency Graph requirements
+std::pair<std::vector<int>::const_iterator, std::vector<int>::const_iterator>
+adjacent_vertices(int vertex, const dist_graph_communicator& comm)
+{
+  BOOST_ASSERT(vertex == comm.rank());
+  return std::make_pair(comm.destinations().begin(), comm.destinations().end());
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_VERSION >= 3
@@ -0,0 +1,127 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpi/distributed_array.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+
+namespace boost { namespace mpi {
+
+namespace {
+  // The number of elements, among size, of the blocks of the process
+  // of coordinate coord in a grid of nprocs processes.
+  int local_extent(int size, distribution_kind kind, int block, int nprocs, int coord)
+  {
+    switch (kind) {
+    case distribute_none:
+      return size;
+    case distribute_block:
+      {
+        if (block == 0)
+          block = (size + nprocs - 1) / nprocs;
+        int first = coord * block;
+        return std::max(0, std::min(block, size - first));
+      }
+    case distribute_cyclic:
+      {
+        if (block == 0)
+          block = 1;
+        int nblocks = (size + block - 1) / block;
+        if (coord >= nblocks)
+          return 0;
+        int mine = (nblocks - coord + nprocs - 1) / nprocs;
+        int result = mine * block;
+        if ((nblocks - 1) % nprocs == coord)
+          result -= nblocks * block - size; // the last block is partial
+        return result;
+      }
+    }
+    BOOST_ASSERT(false);
+    return 0;
+  }
+}
+
+distributed_array_layout::distributed_array_layout(const cartesian_communicator& grid,
+                                                   const std::vector<array_dimension>& dims)
+  : m_grid_size(grid.size()), m_grid_rank(grid.rank())
+{
+  int ndims = int(dims.size());
+  BOOST_ASSERT(ndims == grid.ndims());
+  cartesian_topology topo(ndims);
+  std::vector<int> coords;
+  grid.topology(topo, coords);
+
+  m_global_sizes.resize(ndims);
+  m_local_sizes.resize(ndims);
+  m_distribs.resize(ndims);
+  m_dargs.resize(ndims);
+  m_psizes.resize(ndims);
+  for (int d = 0; d < ndims; ++d) {
+    array_dimension const& dim = dims[d];
+    BOOST_ASSERT(dim.distribution != distribute_none || topo[d].size == 1);
+    m_global_sizes[d] = dim.size;
+    m_psizes[d] = topo[d].size;
+    m_local_sizes[d] = local_extent(dim.size, dim.distribution, dim.block,
+                                    topo[d].size, coords[d]);
+    switch (dim.distribution) {
+    case distribute_block:  m_distribs[d] = MPI_DISTRIBUTE_BLOCK;  break;
+    case distribute_cyclic: m_distribs[d] = MPI_DISTRIBUTE_CYCLIC; break;
+    case distribute_none:   m_distribs[d] = MPI_DISTRIBUTE_NONE;   break;
+    }
+    m_dargs[d] = dim.block == 0 ? int(MPI_DISTRIBUTE_DFLT_DARG) : dim.block;
+  }
+}
+
+distributed_array_layout::distributed_array_layout(const std::vector<int>& global_sizes,
+                                                   const std::vector<int>& local_sizes,
+                                                   const std::vector<int>& starts)
+  : m_global_sizes(global_sizes), m_local_sizes(local_sizes), m_starts(starts),
+    m_grid_size(0), m_grid_rank(0)
+{
+  BOOST_ASSERT(local_sizes.size() == global_sizes.size());
+  BOOST_ASSERT(starts.size() == global_sizes.size());
+}
+
+std::size_t
+distributed_array_layout::local_size() const
+{
+  std::size_t result = 1;
+  for (std::size_t d = 0; d < m_local_sizes.size(); ++d)
+    result *= std::size_t(m_local_sizes[d]);
+  return result;
+}
+
+MPI_Datatype
+distributed_array_layout::filetype(MPI_Datatype etype) const
+{
+  MPI_Datatype result;
+  int ndims = this->ndims();
+  if (!m_distribs.empty()) {
+    BOOST_MPI_CHECK_RESULT(MPI_Type_create_darray,
+                           (m_grid_size, m_grid_rank, ndims,
+                            const_cast<int*>(detail::c_data(m_global_sizes)),
+                            const_cast<int*>(detail::c_data(m_distribs)),
+                            const_cast<int*>(detail::c_data(m_dargs)),
+                            const_cast<int*>(detail::c_data(m_psizes)),
+                            MPI_ORDER_C, etype, &result));
+  } else if (local_size() == 0) {
+    // MPI_Type_create_subarray rejects empty blocks.
+    BOOST_MPI_CHECK_RESULT(MPI_Type_contiguous, (0, etype, &result));
+  } else {
+    BOOST_MPI_CHECK_RESULT(MPI_Type_create_subarray,
+                           (ndims,
+                            const_cast<int*>(detail::c_data(m_global_sizes)),
+                            const_cast<int*>(detail::c_data(m_local_sizes)),
+                            const_cast<int*>(detail::c_data(m_starts)),
+                            MPI_ORDER_C, etype, &result));
+  }
+  BOOST_MPI_CHECK_RESULT(MPI_Type_commit, (&result));
+  return result;
+}
+
+} } // end namespace boost::mpi
@@ -8,6 +8,9 @@
 #include <boost/mpi/environment.hpp>
 #include <boost/mpi/exception.hpp>
 #include <boost/mpi/detail/mpi_datatype_cache.hpp>
+#include <boost/mpi/progress.hpp>
+#include <boost/mpi/detail/node_hierarchy.hpp>
+#include <boost/mpi/collectives/sparse_all_to_all.hpp>
 #include <boost/core/uncaught_exceptions.hpp>
 #include <cassert>
 #include <string>
@@ -181,7 +184,12 @@ environment::~environment()
     if (boost::core::uncaught_exceptions() > 0 && abort_on_exception) {
       abort(-1);
     } else if (!finalized()) {
+      stop_progress();
       detail::mpi_datatype_cache().clear();
+#if BOOST_MPI_VERSION >= 3
+      detail::release_node_hierarchies();
+      detail::release_sparse_exchange_tags();
+#endif
       BOOST_MPI_CHECK_RESULT(MPI_Finalize, ());
     }
   }
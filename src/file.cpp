@@ -0,0 +1,223 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpi/file.hpp>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/distributed_array.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace boost { namespace mpi {
+
+namespace {
+  // Close the file when the last handle goes away, unless this was
+  // done already or MPI is gone.
+  struct file_close
+  {
+    void operator()(MPI_File* f) const
+    {
+      BOOST_ASSERT(f != 0);
+      int finalized;
+      BOOST_MPI_CHECK_RESULT(MPI_Finalized, (&finalized));
+      if (!finalized && *f != MPI_FILE_NULL)
+        BOOST_MPI_CHECK_RESULT(MPI_File_close, (f));
+      delete f;
+    }
+  };
+
+  // The index of a file written by write_packed_all: the number of
+  // processes, then the offset and size of the archive of each one.
+  typedef unsigned long long index_entry;
+
+  MPI_Offset index_size(int nprocs)
+  {
+    return MPI_Offset(sizeof(index_entry) * (1 + 2 * std::size_t(nprocs)));
+  }
+
+  MPI_Offset entry_offset(int rank)
+  {
+    return MPI_Offset(sizeof(index_entry) * (1 + 2 * std::size_t(rank)));
+  }
+
+  // MPI counts are ints: transfer large archives in pieces. The
+  // collective calls must match, so every process makes as many as
+  // the process with the largest archive.
+  std::size_t const chunk_size = std::size_t(1) << 30;
+
+  int nb_chunks(const communicator& comm, std::size_t size, std::size_t chunk = chunk_size)
+  {
+    int local = int((size + chunk - 1) / chunk);
+    return all_reduce(comm, local, maximum<int>());
+  }
+
+  // The number of elements of type in a piece.
+  std::size_t elements_per_chunk(MPI_Datatype type)
+  {
+    int size;
+    BOOST_MPI_CHECK_RESULT(MPI_Type_size, (type, &size));
+    return std::max(chunk_size / std::size_t(size), std::size_t(1));
+  }
+}
+
+file::file(const communicator& comm, const std::string& filename, int amode,
+           MPI_Info info)
+  : m_comm(comm)
+{
+  MPI_File f;
+  BOOST_MPI_CHECK_RESULT(MPI_File_open,
+                         (MPI_Comm(comm), const_cast<char*>(filename.c_str()),
+                          amode, info, &f));
+  m_file.reset(new MPI_File(f), file_close());
+}
+
+void
+file::close()
+{
+  // Nothing to do without a file, or when it is closed already.
+  if (!m_file || *m_file == MPI_FILE_NULL)
+    return;
+  BOOST_MPI_CHECK_RESULT(MPI_File_close, (m_file.get()));
+}
+
+MPI_Offset
+file::size() const
+{
+  MPI_Offset result;
+  BOOST_MPI_CHECK_RESULT(MPI_File_get_size, (*m_file, &result));
+  return result;
+}
+
+void
+file::resize(MPI_Offset size)
+{
+  BOOST_MPI_CHECK_RESULT(MPI_File_set_size, (*m_file, size));
+}
+
+void
+file::sync()
+{
+  BOOST_MPI_CHECK_RESULT(MPI_File_sync, (*m_file));
+}
+
+void
+file::set_view(MPI_Offset disp, MPI_Datatype etype, MPI_Datatype filetype,
+               const std::string& datarep, MPI_Info info)
+{
+  BOOST_MPI_CHECK_RESULT(MPI_File_set_view,
+                         (*m_file, disp, etype, filetype,
+                          const_cast<char*>(datarep.c_str()), info));
+}
+
+void
+file::write_array_all_impl(const distributed_array_layout& layout, MPI_Datatype type,
+                           const void* local, MPI_Offset disp)
+{
+  MPI_Datatype filetype = layout.filetype(type);
+  set_view(disp, type, filetype);
+  BOOST_MPI_CHECK_RESULT(MPI_Type_free, (&filetype));
+
+  // Offsets count elements of the local part, in the view.
+  // In memory, the elements are one extent apart, padding included.
+  const char* bytes = static_cast<const char*>(local);
+  MPI_Aint lb, extent;
+  BOOST_MPI_CHECK_RESULT(MPI_Type_get_extent, (type, &lb, &extent));
+  std::size_t size  = layout.local_size();
+  std::size_t chunk = elements_per_chunk(type);
+  int chunks = nb_chunks(m_comm, size, chunk);
+  for (int c = 0; c < chunks; ++c) {
+    std::size_t done = std::min(size, c * chunk);
+    int n = int(std::min(size - done, chunk));
+    BOOST_MPI_CHECK_RESULT(MPI_File_write_at_all,
+                           (*m_file, MPI_Offset(done),
+                            const_cast<char*>(bytes) + done * extent, n, type,
+                            MPI_STATUS_IGNORE));
+  }
+}
+
+void
+file::read_array_all_impl(const distributed_array_layout& layout, MPI_Datatype type,
+                          void* local, MPI_Offset disp)
+{
+  MPI_Datatype filetype = layout.filetype(type);
+  set_view(disp, type, filetype);
+  BOOST_MPI_CHECK_RESULT(MPI_Type_free, (&filetype));
+
+  char* bytes = static_cast<char*>(local);
+  MPI_Aint lb, extent;
+  BOOST_MPI_CHECK_RESULT(MPI_Type_get_extent, (type, &lb, &extent));
+  std::size_t size  = layout.local_size();
+  std::size_t chunk = elements_per_chunk(type);
+  int chunks = nb_chunks(m_comm, size, chunk);
+  for (int c = 0; c < chunks; ++c) {
+    std::size_t done = std::min(size, c * chunk);
+    int n = int(std::min(size - done, chunk));
+    BOOST_MPI_CHECK_RESULT(MPI_File_read_at_all,
+                           (*m_file, MPI_Offset(done), bytes + done * extent, n, type,
+                            MPI_STATUS_IGNORE));
+  }
+}
+
+void
+file::write_packed_all(const void* data, std::size_t size)
+{
+  int nprocs = m_comm.size();
+  int rank   = m_comm.rank();
+  set_view(0, MPI_BYTE, MPI_BYTE);
+
+  // The archives follow each other in rank order after the index.
+  index_entry local = size;
+  index_entry before = 0;
+  BOOST_MPI_CHECK_RESULT(MPI_Exscan,
+                         (&local, &before, 1, get_mpi_datatype(local), MPI_SUM,
+                          MPI_Comm(m_comm)));
+  if (rank == 0)
+    before = 0; // undefined on the first process
+  MPI_Offset offset = index_size(nprocs) + MPI_Offset(before);
+
+  // Process 0 writes the number of processes in front of its entry.
+  index_entry entry[3] = { index_entry(nprocs), index_entry(offset), local };
+  if (rank == 0)
+    write_at_all(0, entry, 3);
+  else
+    write_at_all(entry_offset(rank), entry + 1, 2);
+
+  const char* bytes = static_cast<const char*>(data);
+  int chunks = nb_chunks(m_comm, size);
+  for (int c = 0; c < chunks; ++c) {
+    std::size_t done = std::min(size, c * chunk_size);
+    int n = int(std::min(size - done, chunk_size));
+    write_at_all(offset + MPI_Offset(done), bytes + done, n);
+  }
+}
+
+void
+file::read_packed_all(packed_iarchive::buffer_type& buffer)
+{
+  int rank = m_comm.rank();
+  set_view(0, MPI_BYTE, MPI_BYTE);
+
+  index_entry nprocs = 0;
+  read_at_all(0, &nprocs, 1);
+  if (nprocs != index_entry(m_comm.size()))
+    boost::throw_exception(exception("MPI_File_read_at_all", MPI_ERR_IO));
+  index_entry entry[2];
+  read_at_all(entry_offset(rank), entry, 2);
+
+  std::size_t size = std::size_t(entry[1]);
+  buffer.resize(size);
+  char* bytes = detail::c_data(buffer);
+  int chunks = nb_chunks(m_comm, size);
+  for (int c = 0; c < chunks; ++c) {
+    std::size_t done = std::min(size, c * chunk_size);
+    int n = int(std::min(size - done, chunk_size));
+    read_at_all(MPI_Offset(entry[0] + done), bytes + done, n);
+  }
+}
+
+} } // end namespace boost::mpi
@@ -10,64 +10,87 @@
 
 namespace boost { namespace mpi {
 
+graph_communicator::graph_communicator(const shared_ptr<MPI_Comm>& comm_ptr)
+{
+  this->comm_ptr = comm_ptr;
+#ifndef BOOST_DISABLE_ASSERTS
+  int status;
+  BOOST_MPI_CHECK_RESULT(MPI_Topo_test, ((MPI_Comm)*this, &status));
+  BOOST_ASSERT(status == MPI_GRAPH);
+#endif
+  fetch_graph();
+}
+
+graph_communicator::graph_communicator(const MPI_Comm& comm, comm_create_kind kind)
+  : communicator(comm, kind)
+{ 
+#ifndef BOOST_DISABLE_ASSERTS
+  int status;
+  BOOST_MPI_CHECK_RESULT(MPI_Topo_test, ((MPI_Comm)*this, &status));
+  BOOST_ASSERT(status == MPI_GRAPH);
+#endif
+  fetch_graph();
+}
+
+void
+graph_communicator::fetch_graph()
+{
+  shared_ptr<detail::graph_csr> csr(new detail::graph_csr);
+  if (bool(*this)) {
+    int nnodes, nedges;
+    BOOST_MPI_CHECK_RESULT(MPI_Graphdims_get, ((MPI_Comm)*this, &nnodes, &nedges));
+    // MPI_Graph_get returns the cumulative degrees, which are the
+    // offsets of all the vertices but the first one.
+    csr->offsets.resize(nnodes + 1, 0);
+    csr->targets.resize(nedges);
+    if (nnodes > 0) {
+      BOOST_MPI_CHECK_RESULT(MPI_Graph_get,
+                             ((MPI_Comm)*this, nnodes, nedges, 
+                              detail::c_data(csr->offsets) + 1, 
+                              detail::c_data(csr->targets)));
+    }
+  }
+  m_csr = csr;
+}
+
 // Incidence Graph requirements
 std::pair<detail::comm_out_edge_iterator, detail::comm_out_edge_iterator>
 out_edges(int vertex, const graph_communicator& comm)
 {
-  int nneighbors = out_degree(vertex, comm);
-  shared_array<int> neighbors(new int[nneighbors]);
-  BOOST_MPI_CHECK_RESULT(MPI_Graph_neighbors, 
-                         ((MPI_Comm)comm, vertex, nneighbors, neighbors.get()));
-  return std::make_pair(detail::comm_out_edge_iterator(vertex, neighbors, 0),
-                        detail::comm_out_edge_iterator(vertex, neighbors, 
-                                                       nneighbors));
+  const detail::graph_csr& csr = comm.csr();
+  const int* targets = detail::c_data(csr.targets);
+  return std::make_pair(detail::comm_out_edge_iterator(vertex, targets + csr.offsets[vertex]),
+                        detail::comm_out_edge_iterator(vertex, targets + csr.offsets[vertex+1]));
 }
 
 int out_degree(int vertex, const graph_communicator& comm)
 {
-  int nneighbors;
-  BOOST_MPI_CHECK_RESULT(MPI_Graph_neighbors_count, 
-                         ((MPI_Comm)comm, vertex, &nneighbors));
-  return nneighbors;
+  const detail::graph_csr& csr = comm.csr();
+  return csr.offsets[vertex+1] - csr.offsets[vertex];
 }
 
 // Adjacency Graph requirements
 std::pair<detail::comm_adj_iterator, detail::comm_adj_iterator>
 adjacent_vertices(int vertex, const graph_communicator& comm)
 {
-  int nneighbors = out_degree(vertex, comm);
-  shared_array<int> neighbors(new int[nneighbors]);
-  BOOST_MPI_CHECK_RESULT(MPI_Graph_neighbors, 
-                         ((MPI_Comm)comm, vertex, nneighbors, neighbors.get()));
-  return std::make_pair(detail::comm_adj_iterator(neighbors, 0),
-                        detail::comm_adj_iterator(neighbors, nneighbors));
+  const detail::graph_csr& csr = comm.csr();
+  const int* targets = detail::c_data(csr.targets);
+  return std::make_pair(detail::comm_adj_iterator(targets + csr.offsets[vertex]),
+                        detail::comm_adj_iterator(targets + csr.offsets[vertex+1]));
 }
 
 // Edge List Graph requirements
-std::pair<detail::comm_edge_iterator, detail::comm_edge_iterator>
-edges(const graph_communicator& comm);
-
 std::pair<detail::comm_edge_iterator, detail::comm_edge_iterator>
 edges(const graph_communicator& comm)
 {
-  int nnodes, nedges;
-  BOOST_MPI_CHECK_RESULT(MPI_Graphdims_get, ((MPI_Comm)comm, &nnodes, &nedges));
-
-  shared_array<int> indices(new int[nnodes]);
-  shared_array<int> edges(new int[nedges]);
-  BOOST_MPI_CHECK_RESULT(MPI_Graph_get,
-                         ((MPI_Comm)comm, nnodes, nedges, 
-                          indices.get(), edges.get()));
-  return std::make_pair(detail::comm_edge_iterator(indices, edges),
-                        detail::comm_edge_iterator(nedges));
+  const detail::graph_csr& csr = comm.csr();
+  return std::make_pair(detail::comm_edge_iterator(csr),
+                        detail::comm_edge_iterator(num_edges(comm)));
 }
 
-
 int num_edges(const graph_communicator& comm)
 {
-  int nnodes, nedges;
-  BOOST_MPI_CHECK_RESULT(MPI_Graphdims_get, ((MPI_Comm)comm, &nnodes, &nedges));
-  return nedges;
+  return comm.csr().targets.size();
 }
 
 } } // end namespace boost::mpi
@@ -0,0 +1,339 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 3.0 -- Section 6.4.2. Communicator Constructors
+// (MPI_Comm_split_type) and Section 6.7. Caching
+#include <boost/mpi/detail/node_hierarchy.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/mpi/detail/offsets.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/exception.hpp>
+#include <algorithm>
+#include <numeric>
+
+#if BOOST_MPI_VERSION >= 3
+
+namespace boost { namespace mpi {
+
+namespace detail {
+
+namespace {
+// The attribute key under which the hierarchies are cached on the
+// MPI communicators.
+int node_hierarchy_keyval = MPI_KEYVAL_INVALID;
+
+int
+delete_node_hierarchy(MPI_Comm, int, void* attribute, void*)
+{
+  delete static_cast<node_hierarchy*>(attribute);
+  return MPI_SUCCESS;
+}
+
+node_hierarchy*
+cached_node_hierarchy(MPI_Comm comm)
+{
+  if (node_hierarchy_keyval == MPI_KEYVAL_INVALID) {
+    return 0;
+  }
+  void* attribute;
+  int found;
+  BOOST_MPI_CHECK_RESULT(MPI_Comm_get_attr,
+                         (comm, node_hierarchy_keyval, &attribute, &found));
+  return found ? static_cast<node_hierarchy*>(attribute) : 0;
+}
+
+void
+broadcast_buffer(const communicator& comm, int root,
+                 std::vector<char, allocator<char> >& buffer)
+{
+  if (comm.size() < 2) {
+    return;
+  }
+  unsigned long size = buffer.size();
+  BOOST_MPI_CHECK_RESULT(MPI_Bcast, (&size, 1, MPI_UNSIGNED_LONG, root, MPI_Comm(comm)));
+  buffer.resize(size);
+  BOOST_MPI_CHECK_RESULT(MPI_Bcast, (c_data(buffer), int(size), MPI_BYTE, root, MPI_Comm(comm)));
+}
+
+// Decompose comm into nodes, either the given ones or the shared
+// memory ones.
+void
+build_node_hierarchy(const communicator& comm, const communicator* node,
+                     node_hierarchy& h)
+{
+  h.rank = comm.rank();
+  h.shared_memory = !node;
+  if (node) {
+    h.node = *node;
+  } else {
+    MPI_Comm newcomm;
+    BOOST_MPI_CHECK_RESULT(MPI_Comm_split_type,
+                           (MPI_Comm(comm), MPI_COMM_TYPE_SHARED, h.rank,
+                            MPI_INFO_NULL, &newcomm));
+    h.node = communicator(newcomm, comm_take_ownership);
+  }
+  bool is_leader = h.node.rank() == 0;
+  h.leaders = comm.split(is_leader ? 0 : MPI_UNDEFINED, h.rank);
+
+  // Everybody learns the node, and the node rank, of everybody.
+  int node_index = is_leader ? h.leaders.rank() : 0;
+  BOOST_MPI_CHECK_RESULT(MPI_Bcast, (&node_index, 1, MPI_INT, 0, MPI_Comm(h.node)));
+  int local[2] = { node_index, h.node.rank() };
+  int size = comm.size();
+  std::vector<int> all(2*size);
+  BOOST_MPI_CHECK_RESULT(MPI_Allgather,
+                         (local, 2, MPI_INT, c_data(all), 2, MPI_INT, MPI_Comm(comm)));
+  h.node_of.resize(size);
+  h.node_rank_of.resize(size);
+  int nnodes = 0;
+  for (int p = 0; p < size; ++p) {
+    h.node_of[p]      = all[2*p];
+    h.node_rank_of[p] = all[2*p+1];
+    nnodes = std::max(nnodes, h.node_of[p] + 1);
+  }
+  h.node_sizes.assign(nnodes, 0);
+  for (int p = 0; p < size; ++p) {
+    ++h.node_sizes[h.node_of[p]];
+  }
+  std::vector<int> node_offsets(nnodes, 0);
+  std::partial_sum(h.node_sizes.begin(), h.node_sizes.end() - 1, node_offsets.begin() + 1);
+  h.order.resize(size);
+  h.contiguous = true;
+  for (int p = 0; p < size; ++p) {
+    int position = node_offsets[h.node_of[p]] + h.node_rank_of[p];
+    h.order[position] = p;
+    h.contiguous = h.contiguous && position == p;
+  }
+  h.enabled = false;
+}
+} // end anonymous namespace
+
+node_hierarchy&
+get_node_hierarchy(const communicator& comm, const communicator* node)
+{
+  node_hierarchy* cached = cached_node_hierarchy(comm);
+  if (cached && !node) {
+    return *cached;
+  }
+  if (node_hierarchy_keyval == MPI_KEYVAL_INVALID) {
+    BOOST_MPI_CHECK_RESULT(MPI_Comm_create_keyval,
+                           (MPI_COMM_NULL_COPY_FN, &delete_node_hierarchy,
+                            &node_hierarchy_keyval, 0));
+  }
+
+  node_hierarchy* result = new node_hierarchy;
+  build_node_hierarchy(comm, node, *result);
+  result->enabled = cached ? cached->enabled : false;
+  // Keep the shared memory hierarchy, which is not recomputed.
+  if (cached) {
+    result->shared_memory_nodes = cached->shared_memory
+      ? shared_ptr<node_hierarchy>(new node_hierarchy(*cached))
+      : cached->shared_memory_nodes;
+  }
+  BOOST_MPI_CHECK_RESULT(MPI_Comm_set_attr,
+                         (MPI_Comm(comm), node_hierarchy_keyval, result));
+  return *result;
+}
+
+node_hierarchy
+shared_memory_hierarchy(const communicator& comm)
+{
+  node_hierarchy* cached = cached_node_hierarchy(comm);
+  if (!cached) {
+    return get_node_hierarchy(comm);
+  } else if (cached->shared_memory) {
+    return *cached;
+  } else {
+    if (!cached->shared_memory_nodes) {
+      cached->shared_memory_nodes.reset(new node_hierarchy);
+      build_node_hierarchy(comm, 0, *cached->shared_memory_nodes);
+    }
+    return *cached->shared_memory_nodes;
+  }
+}
+
+const node_hierarchy*
+active_node_hierarchy(const communicator& comm)
+{
+  const node_hierarchy* h = cached_node_hierarchy(comm);
+  return (h && h->enabled && h->worthwhile()) ? h : 0;
+}
+
+void
+hierarchical_broadcast(const node_hierarchy& h, int root,
+                       std::vector<char, allocator<char> >& buffer)
+{
+  int root_node = h.node_of[root];
+  bool on_root_node = h.node_of[h.rank] == root_node;
+  if (on_root_node) {
+    broadcast_buffer(h.node, h.node_rank_of[root], buffer);
+  }
+  if (h.leaders) {
+    broadcast_buffer(h.leaders, root_node, buffer);
+  }
+  if (!on_root_node) {
+    broadcast_buffer(h.node, 0, buffer);
+  }
+}
+
+void
+hierarchical_gather(const node_hierarchy& h, int root,
+                    const void* data, int size,
+                    std::vector<char, allocator<char> >& buffer,
+                    std::vector<int>& sizes, std::vector<int>& offsets)
+{
+  // Gather the sizes and the bytes of the node at its leader.
+  bool is_leader = bool(h.leaders);
+  int node_size = h.node.size();
+  std::vector<int> member_sizes(is_leader ? node_size : 0);
+  BOOST_MPI_CHECK_RESULT(MPI_Gather,
+                         (&size, 1, MPI_INT, c_data(member_sizes), 1, MPI_INT,
+                          0, MPI_Comm(h.node)));
+  std::vector<int> member_offsets(member_sizes.size());
+  if (is_leader) {
+    sizes2offsets(member_sizes, member_offsets);
+  }
+  std::vector<char, allocator<char> > node_buffer(std::accumulate(member_sizes.begin(),
+                                                                  member_sizes.end(), 0));
+  BOOST_MPI_CHECK_RESULT(MPI_Gatherv,
+                         (const_cast<void*>(data), size, MPI_BYTE,
+                          c_data(node_buffer), c_data(member_sizes),
+                          c_data(member_offsets), MPI_BYTE,
+                          0, MPI_Comm(h.node)));
+
+  // Gather the nodes at the leader of the node of root.
+  int root_node = h.node_of[root];
+  int nprocs = h.node_of.size();
+  std::vector<int> ordered_sizes;
+  if (is_leader) {
+    int nnodes = h.node_sizes.size();
+    bool at_target = h.leaders.rank() == root_node;
+    std::vector<int> node_offsets;
+    if (at_target) {
+      ordered_sizes.resize(nprocs);
+      sizes2offsets(h.node_sizes, node_offsets);
+    }
+    BOOST_MPI_CHECK_RESULT(MPI_Gatherv,
+                           (c_data(member_sizes), node_size, MPI_INT,
+                            c_data(ordered_sizes), const_cast<int*>(c_data(h.node_sizes)),
+                            c_data(node_offsets), MPI_INT,
+                            root_node, MPI_Comm(h.leaders)));
+    int node_bytes = node_buffer.size();
+    std::vector<int> node_bytes_all(at_target ? nnodes : 0);
+    BOOST_MPI_CHECK_RESULT(MPI_Gather,
+                           (&node_bytes, 1, MPI_INT, c_data(node_bytes_all), 1, MPI_INT,
+                            root_node, MPI_Comm(h.leaders)));
+    std::vector<int> node_bytes_offsets(node_bytes_all.size());
+    if (at_target) {
+      sizes2offsets(node_bytes_all, node_bytes_offsets);
+      buffer.resize(std::accumulate(node_bytes_all.begin(), node_bytes_all.end(), 0));
+    }
+    BOOST_MPI_CHECK_RESULT(MPI_Gatherv,
+                           (c_data(node_buffer), node_bytes, MPI_BYTE,
+                            c_data(buffer), c_data(node_bytes_all),
+                            c_data(node_bytes_offsets), MPI_BYTE,
+                            root_node, MPI_Comm(h.leaders)));
+  }
+
+  // Hand everything over to root if it is not the leader of its node.
+  int root_node_rank = h.node_rank_of[root];
+  if (root_node_rank != 0 && h.node_of[h.rank] == root_node) {
+    int tag = environment::collectives_tag();
+    if (is_leader) {
+      BOOST_MPI_CHECK_RESULT(MPI_Send,
+                             (c_data(ordered_sizes), nprocs, MPI_INT,
+                              root_node_rank, tag, MPI_Comm(h.node)));
+      BOOST_MPI_CHECK_RESULT(MPI_Send,
+                             (c_data(buffer), int(buffer.size()), MPI_BYTE,
+                              root_node_rank, tag, MPI_Comm(h.node)));
+    } else if (h.rank == root) {
+      ordered_sizes.resize(nprocs);
+      BOOST_MPI_CHECK_RESULT(MPI_Recv,
+                             (c_data(ordered_sizes), nprocs, MPI_INT,
+                              0, tag, MPI_Comm(h.node), MPI_STATUS_IGNORE));
+      buffer.resize(std::accumulate(ordered_sizes.begin(), ordered_sizes.end(), 0));
+      BOOST_MPI_CHECK_RESULT(MPI_Recv,
+                             (c_data(buffer), int(buffer.size()), MPI_BYTE,
+                              0, tag, MPI_Comm(h.node), MPI_STATUS_IGNORE));
+    }
+  }
+
+  // The bytes are stored node after node, index them by rank.
+  if (h.rank == root) {
+    sizes.resize(nprocs);
+    offsets.resize(nprocs);
+    int offset = 0;
+    for (int i = 0; i < nprocs; ++i) {
+      int p = h.order[i];
+      sizes[p]   = ordered_sizes[i];
+      offsets[p] = offset;
+      offset    += ordered_sizes[i];
+    }
+  }
+}
+
+void
+release_node_hierarchies()
+{
+  if (node_hierarchy_keyval != MPI_KEYVAL_INVALID) {
+    if (cached_node_hierarchy(MPI_COMM_WORLD)) {
+      BOOST_MPI_CHECK_RESULT(MPI_Comm_delete_attr, (MPI_COMM_WORLD, node_hierarchy_keyval));
+    }
+    if (cached_node_hierarchy(MPI_COMM_SELF)) {
+      BOOST_MPI_CHECK_RESULT(MPI_Comm_delete_attr, (MPI_COMM_SELF, node_hierarchy_keyval));
+    }
+    BOOST_MPI_CHECK_RESULT(MPI_Comm_free_keyval, (&node_hierarchy_keyval));
+  }
+}
+
+} // end namespace detail
+
+communicator communicator::split_shared(int key) const
+{
+  MPI_Comm newcomm;
+  BOOST_MPI_CHECK_RESULT(MPI_Comm_split_type,
+                         (MPI_Comm(*this), MPI_COMM_TYPE_SHARED, key,
+                          MPI_INFO_NULL, &newcomm));
+  return communicator(newcomm, comm_take_ownership);
+}
+
+communicator communicator::split_shared() const
+{
+  return split_shared(rank());
+}
+
+communicator communicator::node_communicator() const
+{
+  return detail::shared_memory_hierarchy(*this).node;
+}
+
+communicator communicator::node_leaders_communicator() const
+{
+  return detail::shared_memory_hierarchy(*this).leaders;
+}
+
+void communicator::enable_hierarchical_collectives(bool enable) const
+{
+  if (enable) {
+    detail::get_node_hierarchy(*this).enabled = true;
+  } else if (detail::active_node_hierarchy(*this)) {
+    detail::get_node_hierarchy(*this).enabled = false;
+  }
+}
+
+void communicator::enable_hierarchical_collectives(const communicator& node) const
+{
+  detail::get_node_hierarchy(*this, &node).enabled = true;
+}
+
+bool communicator::hierarchical_collectives_enabled() const
+{
+  return detail::active_node_hierarchy(*this) != 0;
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_VERSION >= 3
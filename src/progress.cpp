@@ -0,0 +1,283 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpi/progress.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/assert.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
+#include <vector>
+
+#if !defined(BOOST_NO_CXX11_HDR_MUTEX) && !defined(BOOST_NO_CXX11_HDR_THREAD) \
+  && !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_CHRONO)
+#  define BOOST_MPI_HAS_PROGRESS_THREAD 1
+#  include <atomic>
+#  include <chrono>
+#  include <mutex>
+#  include <thread>
+#endif
+
+namespace boost { namespace mpi {
+
+namespace detail {
+
+#if defined(BOOST_MPI_HAS_PROGRESS_THREAD)
+typedef std::mutex progress_mutex;
+#else
+// Without threads, there is nothing to protect against.
+struct progress_mutex
+{
+  void lock() {}
+  bool try_lock() { return true; }
+  void unlock() {}
+};
+#endif
+
+struct progress_lock
+{
+  explicit progress_lock(progress_mutex& m) : m_mutex(m) { m_mutex.lock(); }
+  ~progress_lock() { m_mutex.unlock(); }
+  progress_mutex& m_mutex;
+};
+
+// Whether the engine still advances the requests it registered in
+// the given generation, in the background.
+bool progressed_in_background(unsigned long generation);
+
+/**
+ * Wrap the handler of a request so that the progress engine and the
+ * owner of the request can both advance it: the first one to see it
+ * complete keeps the status for the other.
+ */
+class progressed_handler : public request::handler
+{
+public:
+  progressed_handler(request::handler* h, unsigned long generation)
+    : m_inner(h), m_delivered(false), m_generation(generation) {}
+
+  status wait()
+  {
+    progress_lock lock(m_mutex);
+    if (!m_done) {
+      m_done = m_inner->wait();
+    }
+    m_delivered = true;
+    return *m_done;
+  }
+
+  optional<status> test()
+  {
+    progress_lock lock(m_mutex);
+    if (!m_done) {
+      m_done = m_inner->test();
+    }
+    m_delivered = bool(m_done);
+    return m_done;
+  }
+
+  void cancel()
+  {
+    progress_lock lock(m_mutex);
+    m_inner->cancel();
+  }
+
+  bool active() const
+  {
+    progress_lock lock(m_mutex);
+    return !m_delivered && (bool(m_done) || m_inner->active());
+  }
+
+  optional<MPI_Request&> trivial() { return boost::none; }
+
+  bool progresses() const { return progressed_in_background(m_generation); }
+
+  // Take the steps that do not block, unless the owner is busy with
+  // the request. Tell whether the request is done with.
+  bool advance(bool& completed)
+  {
+    completed = false;
+    if (!m_mutex.try_lock()) {
+      return false;
+    }
+    if (!m_done && m_inner->active()) {
+      m_done = m_inner->test();
+      completed = bool(m_done);
+    }
+    bool done = bool(m_done) || !m_inner->active();
+    m_mutex.unlock();
+    return done;
+  }
+
+private:
+  scoped_ptr<request::handler> m_inner;
+  mutable progress_mutex       m_mutex;
+  optional<status>             m_done;
+  bool                         m_delivered;
+  unsigned long                m_generation;
+};
+
+namespace {
+struct progress_engine
+{
+  progress_engine() : mode(progress_none), interval(100), generation(0) {}
+
+  progress_mutex                            mutex;
+  // Held during a pass over the requests.
+  progress_mutex                            pass;
+  progress_mode                             mode;
+  int                                       interval;
+  // Incremented by each start_progress().
+  unsigned long                             generation;
+  std::vector<weak_ptr<progressed_handler> > handlers;
+#if defined(BOOST_MPI_HAS_PROGRESS_THREAD)
+  std::thread                               thread;
+  std::atomic<bool>                         stopping;
+#endif
+};
+
+progress_engine& engine()
+{
+  static progress_engine the_engine;
+  return the_engine;
+}
+
+#if defined(BOOST_MPI_HAS_PROGRESS_THREAD)
+void
+progress_loop(int interval)
+{
+  while (!engine().stopping.load()) {
+    progress();
+    std::this_thread::sleep_for(std::chrono::microseconds(interval));
+  }
+}
+#endif
+} // end anonymous namespace
+
+bool
+progressed_in_background(unsigned long generation)
+{
+  progress_engine& e = engine();
+  progress_lock lock(e.mutex);
+  return e.mode == progress_background && e.generation == generation;
+}
+} // end namespace detail
+
+request
+request::progressed(handler* h)
+{
+  detail::progress_engine& e = detail::engine();
+  detail::progress_lock lock(e.mutex);
+  if (e.mode == progress_none) {
+    return request(h);
+  }
+  shared_ptr<detail::progressed_handler> wrapper(new detail::progressed_handler(h, e.generation));
+  e.handlers.push_back(wrapper);
+  request result;
+  result.m_handler = wrapper;
+  return result;
+}
+
+void
+start_progress(progress_mode mode, int interval)
+{
+  BOOST_ASSERT(interval >= 0);
+  stop_progress();
+  if (mode == progress_background) {
+#if defined(BOOST_MPI_HAS_PROGRESS_THREAD)
+    if (environment::thread_level() != threading::multiple) {
+      boost::throw_exception(exception("MPI_Query_thread", MPI_ERR_OTHER));
+    }
+#else
+    boost::throw_exception(exception("MPI_Query_thread", MPI_ERR_UNSUPPORTED_OPERATION));
+#endif
+  }
+  detail::progress_engine& e = detail::engine();
+  {
+    detail::progress_lock lock(e.mutex);
+    e.mode = mode;
+    e.interval = interval;
+    ++e.generation;
+  }
+#if defined(BOOST_MPI_HAS_PROGRESS_THREAD)
+  if (mode == progress_background) {
+    e.stopping = false;
+    e.thread = std::thread(detail::progress_loop, interval);
+  }
+#endif
+}
+
+void
+stop_progress()
+{
+  detail::progress_engine& e = detail::engine();
+#if defined(BOOST_MPI_HAS_PROGRESS_THREAD)
+  if (e.thread.joinable()) {
+    e.stopping = true;
+    e.thread.join();
+  }
+#endif
+  detail::progress_lock pass(e.pass);
+  detail::progress_lock lock(e.mutex);
+  e.mode = progress_none;
+  e.handlers.clear();
+}
+
+progress_mode
+current_progress_mode()
+{
+  detail::progress_engine& e = detail::engine();
+  detail::progress_lock lock(e.mutex);
+  return e.mode;
+}
+
+int
+progress()
+{
+  BOOST_ASSERT(environment::thread_level() != threading::funneled
+               || environment::is_main_thread());
+  detail::progress_engine& e = detail::engine();
+  // Leave the requests to the pass in progress in another thread.
+  if (!e.pass.try_lock()) {
+    return 0;
+  }
+  // Work on a copy, so that new requests can be made meanwhile.
+  std::vector<shared_ptr<detail::progressed_handler> > handlers;
+  {
+    detail::progress_lock lock(e.mutex);
+    handlers.reserve(e.handlers.size());
+    for (std::size_t i = 0; i < e.handlers.size(); ++i) {
+      handlers.push_back(e.handlers[i].lock());
+    }
+  }
+  int completed = 0;
+  std::vector<bool> done(handlers.size(), true);
+  for (std::size_t i = 0; i < handlers.size(); ++i) {
+    if (handlers[i]) {
+      bool just_completed;
+      done[i] = handlers[i]->advance(just_completed);
+      completed += just_completed;
+    }
+  }
+  {
+    // Forget the requests that are done with, or have been dropped.
+    // The ones registered during the pass come after those we had.
+    detail::progress_lock lock(e.mutex);
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < e.handlers.size(); ++i) {
+      if (i >= done.size() || !done[i]) {
+        e.handlers[kept++] = e.handlers[i];
+      }
+    }
+    e.handlers.resize(kept);
+  }
+  e.pass.unlock();
+  return completed;
+}
+
+} } // end namespace boost::mpi
@@ -7,6 +7,8 @@
 #include <boost/mpi/status.hpp>
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/detail/request_handlers.hpp>
+#include <boost/mpi/detail/test_batch.hpp>
+#include <boost/mpi/detail/antiques.hpp>
 
 namespace boost { namespace mpi {
 
@@ -44,6 +46,15 @@ request::make_empty_send(communicator const& comm, int dest, int tag) {
   return request(handler);
 }
 
+#if BOOST_MPI_VERSION >= 3
+request
+request::make_ibarrier(communicator const& comm) {
+  trivial_handler* handler = new trivial_handler;
+  BOOST_MPI_CHECK_RESULT(MPI_Ibarrier, (comm, &handler->m_request));
+  return request(handler);
+}
+#endif
+
 request
 request::make_bottom_recv(communicator const& comm, int dest, int tag, MPI_Datatype tp) {
   trivial_handler* handler = new trivial_handler;
@@ -235,5 +246,42 @@ optional<MPI_Request&>
 request::dynamic_handler::trivial() {
   return boost::none;
 }
+
+namespace detail {
+void
+test_batch(request* const* requests, int n, std::vector<std::pair<int, status> >& completed)
+{
+  // The trivial requests are tested together, the others one by one.
+  std::vector<MPI_Request> trivial;
+  std::vector<int> positions;
+  for (int i = 0; i < n; ++i) {
+    request& r = *requests[i];
+    if (!r.active()) {
+      continue;
+    }
+    if (optional<MPI_Request&> mpi_request = r.trivial()) {
+      trivial.push_back(*mpi_request);
+      positions.push_back(i);
+    } else if (optional<status> stat = r.test()) {
+      completed.push_back(std::make_pair(i, *stat));
+    }
+  }
+  if (trivial.empty()) {
+    return;
+  }
+  int outcount;
+  std::vector<int> indices(trivial.size());
+  std::vector<MPI_Status> stats(trivial.size());
+  BOOST_MPI_CHECK_RESULT(MPI_Testsome,
+                         (int(trivial.size()), c_data(trivial), &outcount,
+                          c_data(indices), c_data(stats)));
+  for (int k = 0; k < outcount; ++k) {
+    int i = positions[indices[k]];
+    // MPI has released the request.
+    *requests[i]->trivial() = trivial[indices[k]];
+    completed.push_back(std::make_pair(i, status(stats[k])));
+  }
+}
+} // end namespace detail
   
 } } // end namespace boost::mpi
@@ -0,0 +1,55 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 2.0 -- Section 6.7. Caching
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/exception.hpp>
+#include <cstddef>
+
+#if BOOST_MPI_VERSION >= 3
+
+namespace boost { namespace mpi { namespace detail {
+
+namespace {
+// The attribute key under which the number of sparse exchanges made
+// so far is cached on the MPI communicators. The count is stored in
+// the attribute value itself, so that there is nothing to free;
+// duplicates of a communicator start over from zero.
+int sparse_exchange_keyval = MPI_KEYVAL_INVALID;
+}
+
+int
+sparse_exchange_tag(const communicator& comm)
+{
+  if (sparse_exchange_keyval == MPI_KEYVAL_INVALID) {
+    BOOST_MPI_CHECK_RESULT(MPI_Comm_create_keyval,
+                           (MPI_COMM_NULL_COPY_FN, MPI_COMM_NULL_DELETE_FN,
+                            &sparse_exchange_keyval, 0));
+  }
+  void* attribute;
+  int found;
+  BOOST_MPI_CHECK_RESULT(MPI_Comm_get_attr,
+                         (MPI_Comm(comm), sparse_exchange_keyval, &attribute, &found));
+  std::size_t count = found ? reinterpret_cast<std::size_t>(attribute) : 0;
+  BOOST_MPI_CHECK_RESULT(MPI_Comm_set_attr,
+                         (MPI_Comm(comm), sparse_exchange_keyval,
+                          reinterpret_cast<void*>(count + 1)));
+  // The two tags reserved after the collectives one.
+  return environment::collectives_tag() + 1 + int(count % 2);
+}
+
+void
+release_sparse_exchange_tags()
+{
+  if (sparse_exchange_keyval != MPI_KEYVAL_INVALID) {
+    BOOST_MPI_CHECK_RESULT(MPI_Comm_free_keyval, (&sparse_exchange_keyval));
+  }
+}
+
+} } } // end namespace boost::mpi::detail
+
+#endif // BOOST_MPI_VERSION >= 3
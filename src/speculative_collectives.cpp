@@ -0,0 +1,204 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Message Passing Interface 1.1 -- Section 4.4. Broadcast, Section
+// 4.5. Gather, and Section 5.7. Caching
+#include <boost/mpi/detail/speculative_collectives.hpp>
+#include <boost/mpi/detail/antiques.hpp>
+#include <boost/mpi/detail/offsets.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/exception.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+
+namespace {
+// The attribute key under which the slot size is cached on the MPI
+// communicators. The size is stored in the attribute value itself.
+int speculative_slot_keyval = MPI_KEYVAL_INVALID;
+
+// The smallest useful slot: the size of the data, and one byte of it.
+int const min_slot = int(sizeof(int)) + 1;
+
+// Fill a slot with the size of the data and its first bytes.
+void
+fill_slot(int slot, const void* data, int size, std::vector<char>& result)
+{
+  result.resize(slot);
+  std::memcpy(&result[0], &size, sizeof(int));
+  std::memcpy(&result[sizeof(int)], data, std::min(size, slot - int(sizeof(int))));
+}
+
+// Read back the sizes from the slots of all the processes, compute
+// the offsets, and copy the inline bytes in place.
+void
+unpack_slots(int slot, const std::vector<char>& slots,
+             std::vector<char, allocator<char> >& buffer,
+             std::vector<int>& sizes, std::vector<int>& offsets)
+{
+  int nproc = int(slots.size() / slot);
+  sizes.resize(nproc);
+  offsets.resize(nproc);
+  for (int p = 0; p < nproc; ++p) {
+    std::memcpy(&sizes[p], &slots[p * slot], sizeof(int));
+  }
+  sizes2offsets(sizes, offsets);
+  buffer.resize(std::accumulate(sizes.begin(), sizes.end(), 0));
+  int room = slot - int(sizeof(int));
+  for (int p = 0; p < nproc; ++p) {
+    std::memcpy(c_data(buffer) + offsets[p], &slots[p * slot + sizeof(int)],
+                std::min(sizes[p], room));
+  }
+}
+} // end anonymous namespace
+
+int
+speculative_slot(const communicator& comm)
+{
+  if (speculative_slot_keyval == MPI_KEYVAL_INVALID || !comm) {
+    return 0;
+  }
+  void* attribute;
+  int found;
+  BOOST_MPI_CHECK_RESULT(MPI_Comm_get_attr,
+                         (MPI_Comm(comm), speculative_slot_keyval, &attribute, &found));
+  return found ? int(reinterpret_cast<std::ptrdiff_t>(attribute)) : 0;
+}
+
+void
+speculative_gather(const communicator& comm, int root, int slot,
+                   const void* data, int size,
+                   std::vector<char, allocator<char> >& buffer,
+                   std::vector<int>& sizes, std::vector<int>& offsets)
+{
+  int nproc = comm.size();
+  bool is_root = comm.rank() == root;
+  int room = slot - int(sizeof(int));
+  int tag = environment::collectives_tag();
+
+  std::vector<char> mine;
+  fill_slot(slot, data, size, mine);
+  std::vector<char> slots(is_root ? nproc * slot : 0);
+  BOOST_MPI_CHECK_RESULT(MPI_Gather,
+                         (c_data(mine), slot, MPI_BYTE,
+                          c_data(slots), slot, MPI_BYTE, root, MPI_Comm(comm)));
+  if (!is_root) {
+    if (size > room) {
+      BOOST_MPI_CHECK_RESULT(MPI_Send,
+                             (static_cast<char*>(const_cast<void*>(data)) + room,
+                              size - room, MPI_BYTE, root, tag, MPI_Comm(comm)));
+    }
+    return;
+  }
+  unpack_slots(slot, slots, buffer, sizes, offsets);
+  for (int p = 0; p < nproc; ++p) {
+    if (sizes[p] <= room) {
+      continue;
+    }
+    char* rest = c_data(buffer) + offsets[p] + room;
+    if (p == root) {
+      std::memcpy(rest, static_cast<const char*>(data) + room, size - room);
+    } else {
+      BOOST_MPI_CHECK_RESULT(MPI_Recv,
+                             (rest, sizes[p] - room, MPI_BYTE, p, tag,
+                              MPI_Comm(comm), MPI_STATUS_IGNORE));
+    }
+  }
+}
+
+void
+speculative_all_gather(const communicator& comm, int slot,
+                       const void* data, int size,
+                       std::vector<char, allocator<char> >& buffer,
+                       std::vector<int>& sizes, std::vector<int>& offsets)
+{
+  int nproc = comm.size();
+  int room = slot - int(sizeof(int));
+
+  std::vector<char> mine;
+  fill_slot(slot, data, size, mine);
+  std::vector<char> slots(nproc * slot);
+  BOOST_MPI_CHECK_RESULT(MPI_Allgather,
+                         (c_data(mine), slot, MPI_BYTE,
+                          c_data(slots), slot, MPI_BYTE, MPI_Comm(comm)));
+  unpack_slots(slot, slots, buffer, sizes, offsets);
+
+  // Everybody knows whether some data did not fit.
+  std::vector<int> rest_sizes(nproc);
+  std::vector<int> rest_offsets(nproc);
+  bool overflow = false;
+  for (int p = 0; p < nproc; ++p) {
+    rest_sizes[p]   = std::max(sizes[p] - room, 0);
+    rest_offsets[p] = offsets[p] + std::min(sizes[p], room);
+    overflow = overflow || rest_sizes[p] > 0;
+  }
+  if (overflow) {
+    int rank = comm.rank();
+    BOOST_MPI_CHECK_RESULT(MPI_Allgatherv,
+                           (static_cast<char*>(const_cast<void*>(data)) + size - rest_sizes[rank],
+                            rest_sizes[rank], MPI_BYTE,
+                            c_data(buffer), c_data(rest_sizes), c_data(rest_offsets),
+                            MPI_BYTE, MPI_Comm(comm)));
+  }
+}
+
+void
+speculative_broadcast(const communicator& comm, int root, int slot,
+                      std::vector<char, allocator<char> >& buffer)
+{
+  slot = std::max(slot, min_slot);
+  int room = slot - int(sizeof(int));
+  bool is_root = comm.rank() == root;
+
+  int size = int(buffer.size());
+  std::vector<char> head;
+  if (is_root) {
+    fill_slot(slot, c_data(buffer), size, head);
+  } else {
+    head.resize(slot);
+  }
+  BOOST_MPI_CHECK_RESULT(MPI_Bcast, (c_data(head), slot, MPI_BYTE, root, MPI_Comm(comm)));
+  if (!is_root) {
+    std::memcpy(&size, c_data(head), sizeof(int));
+    buffer.resize(size);
+    std::memcpy(c_data(buffer), c_data(head) + sizeof(int), std::min(size, room));
+  }
+  if (size > room) {
+    BOOST_MPI_CHECK_RESULT(MPI_Bcast,
+                           (c_data(buffer) + room, size - room, MPI_BYTE,
+                            root, MPI_Comm(comm)));
+  }
+}
+
+} // end namespace detail
+
+void communicator::enable_speculative_collectives(int slot) const
+{
+  using detail::speculative_slot_keyval;
+  if (speculative_slot_keyval == MPI_KEYVAL_INVALID) {
+    BOOST_MPI_CHECK_RESULT(MPI_Comm_create_keyval,
+                           (MPI_COMM_NULL_COPY_FN, MPI_COMM_NULL_DELETE_FN,
+                            &speculative_slot_keyval, 0));
+  }
+  if (slot > 0) {
+    slot = std::max(slot, detail::min_slot);
+  }
+  BOOST_MPI_CHECK_RESULT(MPI_Comm_set_attr,
+                         (MPI_Comm(*this), speculative_slot_keyval,
+                          reinterpret_cast<void*>(std::ptrdiff_t(slot))));
+}
+
+int communicator::speculative_collectives_slot() const
+{
+  return detail::speculative_slot(*this);
+}
+
+} } // end namespace boost::mpi
@@ -0,0 +1,129 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpi/submission_queue.hpp>
+
+#if defined(BOOST_MPI_HAS_SUBMISSION_QUEUE)
+
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/detail/test_batch.hpp>
+#include <boost/throw_exception.hpp>
+#include <algorithm>
+#include <chrono>
+
+namespace boost { namespace mpi {
+
+submission_queue::~submission_queue()
+{
+  if (m_thread.joinable()) {
+    stop();
+  }
+  while (pending() > 0) {
+    poll();
+  }
+}
+
+std::size_t
+submission_queue::poll()
+{
+  std::size_t handled = 0;
+  // Start the submitted operations, in order.
+  while (detail::mpsc_node* n = m_queue.pop()) {
+    detail::submitted_operation* op = static_cast<detail::submitted_operation*>(n);
+    ++handled;
+    bool waits = false;
+    try {
+      waits = op->start(m_comm);
+    } catch (...) {
+      op->fail(std::current_exception());
+    }
+    if (waits) {
+      m_active.push_back(op);
+    } else {
+      delete op;
+      --m_pending;
+    }
+  }
+  if (m_active.empty()) {
+    return handled;
+  }
+
+  std::vector<request*> requests(m_active.size());
+  for (std::size_t i = 0; i < m_active.size(); ++i) {
+    requests[i] = &m_active[i]->m_request;
+  }
+  std::vector<std::pair<int, status> > completed;
+  try {
+    detail::test_batch(&requests[0], int(requests.size()), completed);
+  } catch (...) {
+    // We cannot tell which operation failed: fail them all.
+    std::exception_ptr e = std::current_exception();
+    for (std::size_t i = 0; i < m_active.size(); ++i) {
+      m_active[i]->fail(e);
+      delete m_active[i];
+      --m_pending;
+    }
+    handled += m_active.size();
+    m_active.clear();
+    return handled;
+  }
+  for (std::size_t k = 0; k < completed.size(); ++k) {
+    detail::submitted_operation*& op = m_active[completed[k].first];
+    op->finish(completed[k].second);
+    delete op;
+    op = 0;
+    --m_pending;
+  }
+  m_active.erase(std::remove(m_active.begin(), m_active.end(),
+                             static_cast<detail::submitted_operation*>(0)),
+                 m_active.end());
+  return handled + completed.size();
+}
+
+void
+submission_queue::start()
+{
+  if (environment::thread_level() < threading::serialized) {
+    boost::throw_exception(exception("MPI_Query_thread", MPI_ERR_OTHER));
+  }
+  BOOST_ASSERT(!m_thread.joinable());
+  m_stopping = false;
+  m_thread = std::thread(&submission_queue::run, this);
+}
+
+void
+submission_queue::stop()
+{
+  if (m_thread.joinable()) {
+    m_stopping = true;
+    m_thread.join();
+  }
+}
+
+void
+submission_queue::run()
+{
+  // Spin while there is work, then back off to sleeps of up to a
+  // millisecond.
+  unsigned idle = 0;
+  while (!m_stopping || pending() > 0) {
+    if (poll() > 0) {
+      idle = 0;
+    } else if (++idle > 64) {
+      if (!m_active.empty()) {
+        std::this_thread::yield();
+      } else {
+        unsigned shift = std::min(idle - 65, 10u);
+        std::this_thread::sleep_for(std::chrono::microseconds(1u << shift));
+      }
+    }
+  }
+}
+
+} } // end namespace boost::mpi
+
+#endif // BOOST_MPI_HAS_SUBMISSION_QUEUE
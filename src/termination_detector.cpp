@@ -0,0 +1,158 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpi/termination_detector.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/status.hpp>
+#include <boost/mpi/wait_policy.hpp>
+
+namespace boost { namespace mpi {
+
+namespace detail {
+
+struct termination_state
+{
+  termination_state(const communicator& c)
+    : comm(c, comm_duplicate), has_previous(false), done(false), waves(0)
+  {
+    counts[0] = counts[1] = 0;
+    previous[0] = previous[1] = 0;
+  }
+
+#if BOOST_MPI_VERSION >= 3
+  // The wave in flight writes into totals: it cannot be cancelled, so
+  // wait for it.
+  ~termination_state()
+  {
+    if (wave.active()) {
+      wave.wait();
+    }
+  }
+#endif
+
+  // Start a wave, or finish the one in flight.
+  bool advance()
+  {
+    if (done) {
+      return true;
+    }
+#if BOOST_MPI_VERSION >= 3
+    if (!wave.active()) {
+      contribution[0] = counts[0];
+      contribution[1] = counts[1];
+      wave = request::make_iall_reduce(comm, contribution, totals, 2, MPI_SUM);
+    }
+    if (!wave.test()) {
+      return false;
+    }
+#else
+    contribution[0] = counts[0];
+    contribution[1] = counts[1];
+    BOOST_MPI_CHECK_RESULT(MPI_Allreduce,
+                           (contribution, totals, 2, get_mpi_datatype<unsigned long>(),
+                            MPI_SUM, MPI_Comm(comm)));
+#endif
+    ++waves;
+    // Counters read at different times can balance while messages are
+    // in transit: only a second wave with the same totals tells.
+    done = (totals[0] == totals[1] && has_previous
+            && totals[0] == previous[0] && totals[1] == previous[1]);
+    previous[0] = totals[0];
+    previous[1] = totals[1];
+    has_previous = true;
+    return done;
+  }
+
+  communicator  comm;
+  // Sent and received, here and in total.
+  unsigned long counts[2];
+  unsigned long contribution[2];
+  unsigned long totals[2];
+  unsigned long previous[2];
+  bool          has_previous;
+  bool          done;
+  unsigned long waves;
+#if BOOST_MPI_VERSION >= 3
+  request       wave;
+#endif
+};
+
+class termination_handler : public request::handler
+{
+public:
+  termination_handler(const shared_ptr<termination_state>& state) : m_state(state) {}
+
+  status wait()
+  {
+    waiter w(default_wait_policy());
+    while (!m_state->advance()) {
+      w.pause(false);
+    }
+    return status();
+  }
+
+  optional<status> test()
+  {
+    return m_state->advance() ? optional<status>(status()) : optional<status>();
+  }
+
+  // The wave in flight is collective: it cannot be cancelled.
+  void cancel() {}
+
+  bool active() const { return !m_state->done; }
+
+  optional<MPI_Request&> trivial() { return boost::none; }
+
+private:
+  shared_ptr<termination_state> m_state;
+};
+
+} // end namespace detail
+
+termination_detector::termination_detector(const communicator& comm)
+  : m_state(new detail::termination_state(comm))
+{
+  m_request = request(new detail::termination_handler(m_state));
+}
+
+void
+termination_detector::sent(unsigned long n)
+{
+  m_state->counts[0] += n;
+}
+
+void
+termination_detector::received(unsigned long n)
+{
+  m_state->counts[1] += n;
+}
+
+bool
+termination_detector::test()
+{
+  return m_state->advance();
+}
+
+void
+termination_detector::wait()
+{
+  m_request.wait();
+}
+
+bool
+termination_detector::terminated() const
+{
+  return m_state->done;
+}
+
+unsigned long
+termination_detector::waves() const
+{
+  return m_state->waves;
+}
+
+} } // end namespace boost::mpi
@@ -0,0 +1,133 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/mpi/wait_policy.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#if !defined(BOOST_NO_CXX11_HDR_ATOMIC) && !defined(BOOST_NO_CXX11_HDR_THREAD) \
+  && !defined(BOOST_NO_CXX11_HDR_CHRONO)
+#  define BOOST_MPI_HAS_WAIT_THREADS 1
+#  include <atomic>
+#  include <chrono>
+#  include <thread>
+#endif
+
+namespace boost { namespace mpi {
+
+namespace detail {
+
+#if defined(BOOST_MPI_HAS_WAIT_THREADS)
+typedef std::atomic<unsigned long> wait_counter;
+#else
+typedef unsigned long wait_counter;
+#endif
+
+struct wait_state
+{
+  wait_state() : waits(0), polls(0), blocks(0)
+  {
+    const char* name = std::getenv("BOOST_MPI_WAIT_POLICY");
+    if (name) {
+      if (std::strcmp(name, "yield") == 0) {
+        policy.strategy = wait_yield;
+      } else if (std::strcmp(name, "backoff") == 0) {
+        policy.strategy = wait_backoff;
+      } else if (std::strcmp(name, "block") == 0) {
+        policy.strategy = wait_block;
+      }
+    }
+  }
+
+  wait_policy  policy;
+  wait_counter waits;
+  wait_counter polls;
+  wait_counter blocks;
+};
+
+wait_state&
+waits()
+{
+  static wait_state state;
+  return state;
+}
+
+waiter::~waiter()
+{
+  if (m_polls > 0) {
+    wait_state& s = waits();
+    ++s.waits;
+    s.polls += m_polls;
+  }
+}
+
+bool
+waiter::pause(bool can_block)
+{
+  if (++m_polls <= static_cast<unsigned long>(m_policy.spins)) {
+    return false;
+  }
+  switch (m_policy.strategy) {
+  case wait_spin:
+    break;
+  case wait_yield:
+#if defined(BOOST_MPI_HAS_WAIT_THREADS)
+    std::this_thread::yield();
+#endif
+    break;
+  case wait_block:
+    if (can_block) {
+      ++waits().blocks;
+      return true;
+    }
+    // Nothing to block on: back off.
+    // fall through
+  case wait_backoff:
+#if defined(BOOST_MPI_HAS_WAIT_THREADS)
+    std::this_thread::sleep_for(std::chrono::microseconds(m_sleep));
+#endif
+    m_sleep = std::min(2 * m_sleep, std::max(m_policy.max_sleep, 1));
+    break;
+  }
+  return false;
+}
+
+} // end namespace detail
+
+wait_policy
+default_wait_policy()
+{
+  return detail::waits().policy;
+}
+
+void
+set_default_wait_policy(const wait_policy& policy)
+{
+  detail::waits().policy = policy;
+}
+
+wait_statistics
+get_wait_statistics()
+{
+  detail::wait_state& s = detail::waits();
+  wait_statistics result;
+  result.waits = s.waits;
+  result.polls = s.polls;
+  result.blocks = s.blocks;
+  return result;
+}
+
+void
+reset_wait_statistics()
+{
+  detail::wait_state& s = detail::waits();
+  s.waits = 0;
+  s.polls = 0;
+  s.blocks = 0;
+}
+
+} } // end namespace boost::mpi
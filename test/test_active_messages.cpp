@@ -0,0 +1,150 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of active messages, with low-level and typed handlers.
+#include <boost/mpi/active_messages.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/lexical_cast.hpp>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::active_messages;
+using boost::mpi::communicator;
+using boost::mpi::packed_iarchive;
+
+int const nvalues = 500;
+
+// A low-level handler, which reads its argument itself.
+struct add_value
+{
+  explicit add_value(long& sum) : sum(&sum) {}
+
+  void operator()(int source, packed_iarchive& ar) const
+  {
+    int value;
+    ar >> value;
+    *sum += source * value;
+  }
+
+  long* sum;
+};
+
+// Run the handlers until @p n of them have, and send the last messages.
+void
+progress_until(active_messages& am, unsigned long n)
+{
+  while (am.handled() < n) {
+    am.progress();
+  }
+  am.flush();
+  am.wait();
+}
+
+int
+test_low_level(const communicator& comm, std::size_t max_bytes)
+{
+  int failed = 0;
+  long sum = 0;
+  active_messages am(comm, 0, max_bytes);
+  am.register_handler(7, add_value(sum));
+  for (int i = 0; i < nvalues; ++i) {
+    for (int dest = 0; dest < comm.size(); ++dest) {
+      am.post(dest, 7, i);
+    }
+  }
+  BOOST_MPI_CHECK(am.posted() == (unsigned long)(nvalues * comm.size()), failed);
+  progress_until(am, nvalues * comm.size());
+  long expected = long(comm.size()) * (comm.size() - 1) / 2 * nvalues * (nvalues - 1) / 2;
+  BOOST_MPI_CHECK(sum == expected, failed);
+  BOOST_MPI_CHECK(am.in_flight() == 0, failed);
+  comm.barrier();
+  return failed;
+}
+
+#if defined(BOOST_MPI_HAS_TYPED_ACTIVE_MESSAGES)
+
+// Sends the message back until no hops are left.
+struct ping
+{
+  ping(active_messages& am, int& returned, bool& ok)
+    : am(&am), returned(&returned), ok(&ok) {}
+
+  void operator()(int source, int hops, const std::string& text) const
+  {
+    *ok = *ok && text == "ping" + boost::lexical_cast<std::string>(hops);
+    if (hops > 0) {
+      am->post<ping>(source, hops - 1, "ping" + boost::lexical_cast<std::string>(hops - 1));
+    } else {
+      ++*returned;
+    }
+  }
+
+  active_messages* am;
+  int* returned;
+  bool* ok;
+};
+
+// Checks a batch of values.
+struct values
+{
+  values(bool& ok) : ok(&ok) {}
+
+  void operator()(int source, std::vector<int> v, double x) const
+  {
+    *ok = *ok && int(v.size()) == source % 5 && x == source;
+  }
+
+  bool* ok;
+};
+
+int
+test_typed(const communicator& comm, std::size_t max_bytes)
+{
+  int failed = 0;
+  int returned = 0;
+  bool ok = true;
+  active_messages am(comm, 1, max_bytes);
+  int p = am.register_handler(ping(am, returned, ok));
+  int v = am.register_handler(values(ok));
+  BOOST_MPI_CHECK(p == 0 && v == 1, failed);
+
+  // Each ping runs twice here, and twice on the right.
+  am.post<ping>((comm.rank() + 1) % comm.size(), 3, "ping3");
+  for (int i = 0; i < nvalues; ++i) {
+    // The int converts to the double the handler takes.
+    am.post<values>(i % comm.size(), std::vector<int>(comm.rank() % 5, i), comm.rank());
+  }
+  // The values sent here by each process.
+  int mine = (nvalues + comm.size() - 1 - comm.rank()) / comm.size();
+  progress_until(am, 4 + mine * comm.size());
+  BOOST_MPI_CHECK(returned == 1, failed);
+  BOOST_MPI_CHECK(ok, failed);
+  comm.barrier();
+  return failed;
+}
+
+#endif
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  // Batched, and sent at once.
+  BOOST_MPI_COUNT_FAILED(test_low_level(world, 65536), failed);
+  BOOST_MPI_COUNT_FAILED(test_low_level(world, 0), failed);
+#if defined(BOOST_MPI_HAS_TYPED_ACTIVE_MESSAGES)
+  BOOST_MPI_COUNT_FAILED(test_typed(world, 65536), failed);
+  BOOST_MPI_COUNT_FAILED(test_typed(world, 0), failed);
+#endif
+  return failed;
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the aggregator, with values that have an MPI datatype and
+// values that are serialized.
+#include <boost/mpi/aggregator.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::aggregator;
+using boost::mpi::communicator;
+
+int const nvalues = 1000;
+
+// Checks that the values of each source come in order.
+template<typename T>
+struct checker
+{
+  checker(int size) : next(size, 0), ok(true) {}
+
+  void operator()(int source, const T& value)
+  {
+    ok = ok && value == expected(source, next[source]);
+    ++next[source];
+  }
+
+  static T expected(int source, int i);
+
+  std::vector<int> next;
+  bool ok;
+};
+
+// The handler given to poll, which is copied.
+template<typename T>
+struct check_handler
+{
+  explicit check_handler(checker<T>& c) : c(&c) {}
+  void operator()(int source, const T& value) const { (*c)(source, value); }
+  checker<T>* c;
+};
+
+template<>
+int
+checker<int>::expected(int source, int i)
+{
+  return source * nvalues + i;
+}
+
+template<>
+std::string
+checker<std::string>::expected(int source, int i)
+{
+  return boost::lexical_cast<std::string>(source) + std::string(i % 13, 'a');
+}
+
+template<typename T>
+int
+test_exchange(const communicator& comm, std::size_t max_bytes, int max_count)
+{
+  int failed = 0;
+  aggregator<T> agg(comm, 0, max_bytes, max_count);
+  checker<T> check(comm.size());
+  // Interleave the destinations, and receive as we go.
+  for (int i = 0; i < nvalues; ++i) {
+    for (int dest = 0; dest < comm.size(); ++dest) {
+      agg.send(dest, checker<T>::expected(comm.rank(), i));
+    }
+    if (i % 100 == 0) {
+      agg.poll(check_handler<T>(check));
+    }
+  }
+  BOOST_MPI_CHECK(agg.sent() == (unsigned long)(nvalues * comm.size()), failed);
+  agg.flush();
+  while (agg.received() < agg.sent()) {
+    agg.poll(check_handler<T>(check));
+  }
+  agg.wait();
+  BOOST_MPI_CHECK(agg.in_flight() == 0, failed);
+  BOOST_MPI_CHECK(check.ok, failed);
+  bool all = true;
+  for (int p = 0; p < comm.size(); ++p) {
+    all = all && check.next[p] == nvalues;
+  }
+  BOOST_MPI_CHECK(all, failed);
+  // Nothing is left over for the next test.
+  comm.barrier();
+  BOOST_MPI_CHECK(agg.poll(check_handler<T>(check)) == 0, failed);
+  comm.barrier();
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  // Flushed on the number of values, on their size, and only at the end.
+  BOOST_MPI_COUNT_FAILED(test_exchange<int>(world, 65536, 7), failed);
+  BOOST_MPI_COUNT_FAILED(test_exchange<int>(world, 100, 4096), failed);
+  BOOST_MPI_COUNT_FAILED(test_exchange<int>(world, 1 << 20, nvalues + 1), failed);
+  BOOST_MPI_COUNT_FAILED(test_exchange<std::string>(world, 65536, 7), failed);
+  BOOST_MPI_COUNT_FAILED(test_exchange<std::string>(world, 100, 4096), failed);
+  BOOST_MPI_COUNT_FAILED(test_exchange<std::string>(world, 1 << 20, nvalues + 1), failed);
+  return failed;
+}
@@ -0,0 +1,192 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the all_to_allv() and all_to_allw() collectives.
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/skeleton_and_content.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/list.hpp>
+#include <boost/lexical_cast.hpp>
+#include <list>
+#include <string>
+#include <vector>
+#include "gps_position.hpp"
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+
+// The number of values process src sends to process dest.
+int
+count(int src, int dest)
+{
+  return (src + 2 * dest) % 4;
+}
+
+struct int_generator
+{
+  typedef int result_type;
+  int operator()(int src, int dest, int i) const { return 1000 * src + 10 * dest + i; }
+};
+
+struct gps_generator
+{
+  typedef gps_position result_type;
+  gps_position operator()(int src, int dest, int i) const
+  {
+    return gps_position(src, dest, i);
+  }
+};
+
+struct string_generator
+{
+  typedef std::string result_type;
+  std::string operator()(int src, int dest, int i) const
+  {
+    return boost::lexical_cast<std::string>(src) + "->" + boost::lexical_cast<std::string>(dest)
+      + std::string(i, '#');
+  }
+};
+
+template<typename Generator>
+int
+all_to_allv_test(const communicator& comm, Generator generator)
+{
+  typedef typename Generator::result_type value_type;
+  int failed = 0;
+  int size = comm.size();
+  int rank = comm.rank();
+
+  std::vector<value_type> in_values;
+  std::vector<int> in_sizes(size);
+  for (int dest = 0; dest < size; ++dest) {
+    in_sizes[dest] = count(rank, dest);
+    for (int i = 0; i < in_sizes[dest]; ++i)
+      in_values.push_back(generator(rank, dest, i));
+  }
+
+  // The receivers do not know what they get.
+  std::vector<value_type> out_values(1);
+  std::vector<int> out_sizes;
+  boost::mpi::all_to_allv(comm, in_values, in_sizes, out_values, out_sizes);
+  bool ok = int(out_sizes.size()) == size;
+  std::size_t k = 0;
+  for (int src = 0; ok && src < size; ++src) {
+    ok = out_sizes[src] == count(src, rank);
+    for (int i = 0; ok && i < out_sizes[src]; ++i)
+      ok = k < out_values.size() && out_values[k++] == generator(src, rank, i);
+  }
+  BOOST_MPI_CHECK(ok && k == out_values.size(), failed);
+
+  // The receivers know it, and leave a gap after the values of each
+  // source.
+  std::vector<int> expected(size);
+  std::vector<int> displs(size);
+  int total = 0;
+  for (int src = 0; src < size; ++src) {
+    expected[src] = count(src, rank);
+    displs[src] = total;
+    total += expected[src] + 1;
+  }
+  value_type gap = generator(-1, -1, 0);
+  std::vector<value_type> spaced(total, gap);
+  std::vector<int> in_displs(size);
+  for (int dest = 1; dest < size; ++dest)
+    in_displs[dest] = in_displs[dest-1] + in_sizes[dest-1];
+  boost::mpi::all_to_allv(comm, &in_values[0], in_sizes, in_displs,
+                          &spaced[0], expected, displs);
+  ok = true;
+  for (int src = 0; ok && src < size; ++src) {
+    for (int i = 0; ok && i < expected[src]; ++i)
+      ok = spaced[displs[src] + i] == generator(src, rank, i);
+    ok = ok && spaced[displs[src] + expected[src]] == gap;
+  }
+  BOOST_MPI_CHECK(ok, failed);
+  return failed;
+}
+
+struct mixed
+{
+  int    i;
+  double d[2];
+};
+
+int
+all_to_allw_test(const communicator& comm)
+{
+  int failed = 0;
+  int size = comm.size();
+  int rank = comm.rank();
+
+  // Even processes send one int, odd ones two doubles, from a
+  // struct and into an array of structs, without packing.
+  std::vector<mixed> in(size);
+  mixed out;
+  out.i = rank;
+  out.d[0] = rank + 0.5;
+  out.d[1] = -rank;
+  char* out_base = reinterpret_cast<char*>(&out);
+  char* in_base = reinterpret_cast<char*>(&in[0]);
+  bool even = rank % 2 == 0;
+  std::vector<int> sizes(size, even ? 1 : 2);
+  std::vector<int> out_displs(size, int((even ? reinterpret_cast<char*>(&out.i)
+                                              : reinterpret_cast<char*>(&out.d)) - out_base));
+  std::vector<MPI_Datatype> types(size, even ? MPI_INT : MPI_DOUBLE);
+  std::vector<int> recv_sizes(size);
+  std::vector<int> in_displs(size);
+  std::vector<MPI_Datatype> recv_types(size);
+  for (int p = 0; p < size; ++p) {
+    bool even_src = p % 2 == 0;
+    recv_sizes[p] = even_src ? 1 : 2;
+    recv_types[p] = even_src ? MPI_INT : MPI_DOUBLE;
+    in_displs[p] = int((even_src ? reinterpret_cast<char*>(&in[p].i)
+                                 : reinterpret_cast<char*>(&in[p].d)) - in_base);
+  }
+  boost::mpi::all_to_allw(comm, &out, sizes, out_displs, types,
+                          in_base, recv_sizes, in_displs, recv_types);
+  bool ok = true;
+  for (int p = 0; ok && p < size; ++p) {
+    if (p % 2 == 0)
+      ok = in[p].i == p;
+    else
+      ok = in[p].d[0] == p + 0.5 && in[p].d[1] == -p;
+  }
+  BOOST_MPI_CHECK(ok, failed);
+
+  // Send the content of a list of three ints to each process.
+  std::vector<std::list<int> > outgoing(size), incoming(size, std::list<int>(3));
+  std::vector<boost::mpi::content> out_contents, in_contents;
+  for (int p = 0; p < size; ++p) {
+    for (int i = 0; i < 3; ++i)
+      outgoing[p].push_back(rank * 100 + p * 10 + i);
+    out_contents.push_back(boost::mpi::get_content(outgoing[p]));
+    in_contents.push_back(boost::mpi::get_content(incoming[p]));
+  }
+  boost::mpi::all_to_allw(comm, out_contents, in_contents);
+  ok = true;
+  for (int p = 0; ok && p < size; ++p) {
+    int i = 0;
+    for (std::list<int>::const_iterator it = incoming[p].begin(); ok && it != incoming[p].end(); ++it)
+      ok = *it == p * 100 + rank * 10 + i++;
+  }
+  BOOST_MPI_CHECK(ok, failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator comm;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(all_to_allv_test(comm, int_generator()), failed);
+  BOOST_MPI_COUNT_FAILED(all_to_allv_test(comm, gps_generator()), failed);
+  BOOST_MPI_COUNT_FAILED(all_to_allv_test(comm, string_generator()), failed);
+  BOOST_MPI_COUNT_FAILED(all_to_allw_test(comm), failed);
+  return failed;
+}
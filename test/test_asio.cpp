@@ -0,0 +1,118 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the communications completed through a Boost.Asio
+// io_context.
+#include <boost/mpi/asio.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/use_future.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::mpi::request_service;
+using boost::mpi::status;
+using boost::system::error_code;
+
+std::string
+value(int rank, int i)
+{
+  return boost::lexical_cast<std::string>(rank) + ":" + std::string(i * 50, 'w');
+}
+
+int
+test_handlers(const communicator& comm)
+{
+  int failed = 0;
+  int right = (comm.rank() + 1) % comm.size();
+  int left  = (comm.rank() + comm.size() - 1) % comm.size();
+  int const n = 50;
+
+  boost::asio::io_context ioc;
+  std::vector<int> in(n, -1);
+  int received = 0;
+  int sent = 0;
+  for (int i = 0; i < n; ++i) {
+    boost::mpi::async_recv(ioc, comm, left, i, in[i],
+                           [&, i](error_code ec, status s) {
+                             received += !ec && s.source() == left && in[i] == left + i;
+                           });
+    boost::mpi::async_send(ioc, comm, right, i, comm.rank() + i,
+                           [&](error_code ec, status) { sent += !ec; });
+  }
+  // A timer shares the loop.
+  bool fired = false;
+  boost::asio::steady_timer timer(ioc, std::chrono::milliseconds(1));
+  timer.async_wait([&](error_code) { fired = true; });
+  ioc.run();
+  BOOST_MPI_CHECK(received == n && sent == n && fired, failed);
+  BOOST_MPI_CHECK(boost::asio::use_service<request_service>(ioc).pending() == 0, failed);
+  return failed;
+}
+
+int
+test_futures(const communicator& comm)
+{
+  int failed = 0;
+  int right = (comm.rank() + 1) % comm.size();
+  int left  = (comm.rank() + comm.size() - 1) % comm.size();
+
+  boost::asio::io_context ioc;
+  // Back off quickly, since the messages may arrive late.
+  boost::asio::use_service<request_service>(ioc).set_backoff(2, std::chrono::microseconds(50));
+  std::string in;
+  std::future<status> r = boost::mpi::async_recv(ioc, comm, left, 0, in,
+                                                 boost::asio::use_future);
+  std::future<status> s = boost::mpi::async_wait(ioc, comm.isend(right, 0, value(comm.rank(), 40)),
+                                                 boost::asio::use_future);
+  // A chain of receives, each one posted by the previous handler.
+  std::vector<std::string> chain(10);
+  int done = 0;
+  std::function<void(error_code, status)> next = [&](error_code, status) {
+    if (++done < int(chain.size()))
+      boost::mpi::async_recv(ioc, comm, left, 1, chain[done], next);
+  };
+  boost::mpi::async_recv(ioc, comm, left, 1, chain[0], next);
+  for (std::size_t i = 0; i < chain.size(); ++i)
+    boost::mpi::async_send(ioc, comm, right, 1, value(comm.rank(), int(i)),
+                           boost::asio::use_future);
+  ioc.run();
+  BOOST_MPI_CHECK(r.get().source() == left && in == value(left, 40), failed);
+  s.get();
+  bool ok = done == int(chain.size());
+  for (std::size_t i = 0; ok && i < chain.size(); ++i)
+    ok = chain[i] == value(left, int(i));
+  BOOST_MPI_CHECK(ok, failed);
+
+  // An empty request completes at once, though the future is set
+  // from a thread of its own.
+  ioc.restart();
+  std::future<status> e = boost::mpi::async_wait(ioc, boost::mpi::request(),
+                                                 boost::asio::use_future);
+  ioc.run();
+  BOOST_MPI_CHECK(e.wait_for(std::chrono::seconds(10)) == std::future_status::ready, failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_handlers(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_futures(world), failed);
+  return failed;
+}
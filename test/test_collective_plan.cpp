@@ -0,0 +1,189 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the serialized gathers and scatters made with a
+// collective_plan, with archives that keep their sizes, grow, or
+// shrink between calls.
+#include <boost/mpi/collective_plan.hpp>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::collective_plan;
+using boost::mpi::communicator;
+using boost::lexical_cast;
+
+// The value of process rank at some iteration, extra characters long.
+std::string
+value(int rank, int extra)
+{
+  return "<" + lexical_cast<std::string>(rank) + ">" + std::string(extra, char('a' + rank % 26));
+}
+
+// The first element of v, if any.
+std::string*
+first_of(std::vector<std::string>& v)
+{
+  return v.empty() ? 0 : &v[0];
+}
+
+// Whether all the processes took a single round.
+bool
+all_single(const communicator& comm, const collective_plan& plan)
+{
+  return boost::mpi::all_reduce(comm, int(plan.single_round()), std::logical_and<int>());
+}
+
+int
+test_all_gather(const communicator& comm)
+{
+  int failed = 0;
+  int size = comm.size();
+  int rank = comm.rank();
+  collective_plan plan(comm);
+  // Same sizes, one process grows, then everything shrinks.
+  int const extras[] = { 3, 3, 3, 0 };
+  bool const single[] = { false, true, false, true };
+  for (int it = 0; it < 4; ++it) {
+    int extra = extras[it] + (it == 2 && rank == size - 1 ? 100 : 0);
+    std::vector<std::string> all;
+    boost::mpi::all_gather(plan, value(rank, extra), all);
+    bool ok = int(all.size()) == size;
+    for (int p = 0; ok && p < size; ++p)
+      ok = all[p] == value(p, extras[it] + (it == 2 && p == size - 1 ? 100 : 0));
+    BOOST_MPI_CHECK(ok, failed);
+    BOOST_MPI_CHECK(plan.single_round() == single[it], failed);
+  }
+
+  // After a reset, the sizes are exchanged again.
+  plan.reset();
+  std::vector<std::string> all;
+  boost::mpi::all_gather(plan, value(rank, 0), all);
+  BOOST_MPI_CHECK(!plan.single_round() && all[size-1] == value(size-1, 0), failed);
+
+  // Values with an MPI datatype ignore the plan.
+  std::vector<int> ranks;
+  boost::mpi::all_gather(plan, rank, ranks);
+  bool ok = int(ranks.size()) == size;
+  for (int p = 0; ok && p < size; ++p)
+    ok = ranks[p] == p;
+  BOOST_MPI_CHECK(ok, failed);
+  return failed;
+}
+
+int
+test_gather(const communicator& comm)
+{
+  int failed = 0;
+  int size = comm.size();
+  int rank = comm.rank();
+  collective_plan plan(comm);
+  for (int root = 0; root < size; root += std::max(size - 1, 1)) {
+    for (int it = 0; it < 3; ++it) {
+      // Process 0 grows on the last iteration.
+      int extra = it == 2 && rank == 0 ? 50 : rank;
+      std::vector<std::string> gathered;
+      boost::mpi::gather(plan, value(rank, extra), gathered, root);
+      if (rank == root) {
+        bool ok = int(gathered.size()) == size;
+        for (int p = 0; ok && p < size; ++p)
+          ok = gathered[p] == value(p, it == 2 && p == 0 ? 50 : p);
+        BOOST_MPI_CHECK(ok, failed);
+      }
+      // A new root starts over.
+      BOOST_MPI_CHECK(all_single(comm, plan) == (it == 1), failed);
+    }
+  }
+
+  // Process p contributes p % 3 values.
+  std::vector<int> sizes(size);
+  int total = 0;
+  for (int p = 0; p < size; ++p) {
+    sizes[p] = p % 3;
+    total += sizes[p];
+  }
+  collective_plan vplan(comm);
+  for (int it = 0; it < 2; ++it) {
+    std::vector<std::string> in_values(sizes[rank], value(rank, it));
+    std::vector<std::string> out_values(rank == 0 ? total : 0);
+    boost::mpi::gatherv(vplan, in_values, first_of(out_values), sizes, 0);
+    if (rank == 0) {
+      bool ok = true;
+      int i = 0;
+      for (int p = 0; p < size; ++p)
+        for (int j = 0; j < sizes[p]; ++j)
+          ok = ok && out_values[i++] == value(p, it);
+      BOOST_MPI_CHECK(ok, failed);
+    }
+  }
+  return failed;
+}
+
+int
+test_scatter(const communicator& comm)
+{
+  int failed = 0;
+  int size = comm.size();
+  int rank = comm.rank();
+  int root = size - 1;
+  collective_plan plan(comm);
+  for (int it = 0; it < 3; ++it) {
+    // The last process receives a longer value on the last iteration.
+    std::vector<std::string> in_values;
+    if (rank == root) {
+      for (int p = 0; p < size; ++p)
+        in_values.push_back(value(p, it == 2 && p == size - 1 ? 60 : 2));
+    }
+    std::string mine;
+    boost::mpi::scatter(plan, in_values, mine, root);
+    BOOST_MPI_CHECK(mine == value(rank, it == 2 && rank == size - 1 ? 60 : 2), failed);
+    BOOST_MPI_CHECK(all_single(comm, plan) == (it == 1), failed);
+  }
+
+  // Process p receives p % 3 + 1 values.
+  std::vector<int> sizes(size);
+  std::vector<std::string> in_values;
+  for (int p = 0; p < size; ++p) {
+    sizes[p] = p % 3 + 1;
+    if (rank == 0)
+      in_values.insert(in_values.end(), sizes[p], value(p, 1));
+  }
+  // The sizes are only needed at the root.
+  std::vector<int> root_sizes;
+  if (rank == 0)
+    root_sizes = sizes;
+  collective_plan vplan(comm);
+  for (int it = 0; it < 2; ++it) {
+    std::vector<std::string> out_values(sizes[rank]);
+    boost::mpi::scatterv(vplan, in_values, root_sizes, first_of(out_values), sizes[rank], 0);
+    bool ok = true;
+    for (int i = 0; i < sizes[rank]; ++i)
+      ok = ok && out_values[i] == value(rank, 1);
+    BOOST_MPI_CHECK(ok, failed);
+  }
+  BOOST_MPI_CHECK(all_single(comm, vplan), failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_all_gather(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_gather(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_scatter(world), failed);
+  return failed;
+}
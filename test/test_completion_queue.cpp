@@ -0,0 +1,179 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the continuations of requests, run by a completion_queue.
+#include <boost/mpi/completion_queue.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::mpi::completion_queue;
+using boost::mpi::request;
+using boost::mpi::status;
+
+int const rounds = 100;
+
+std::string
+value(int rank, int i)
+{
+  return boost::lexical_cast<std::string>(rank) + ":" + std::string(i * 100, 'q');
+}
+
+// Receive rounds values from the left, one after the other: each
+// continuation posts the next receive.
+struct chain
+{
+  chain(const communicator& comm, completion_queue& queue)
+    : comm(comm), queue(queue), received(0), sum(0), in(-1) {}
+
+  void post()
+  {
+    int left = (comm.rank() + comm.size() - 1) % comm.size();
+    queue.push(comm.irecv(left, 0, in).then(next(*this)));
+  }
+
+  struct next
+  {
+    explicit next(chain& c) : c(&c) {}
+    void operator()(const status&) const
+    {
+      c->sum += c->in;
+      if (++c->received < rounds)
+        c->post();
+    }
+    chain* c;
+  };
+
+  communicator      comm;
+  completion_queue& queue;
+  int               received;
+  int               sum;
+  int               in;
+};
+
+// Check a serialized value.
+struct check_value
+{
+  check_value(const std::string& in, const std::string& expected, int& matched)
+    : in(&in), expected(expected), matched(&matched) {}
+  void operator()(const status&) const { *matched += *in == expected; }
+  const std::string* in;
+  std::string        expected;
+  int*               matched;
+};
+
+struct count
+{
+  explicit count(int& n) : n(&n) {}
+  void operator()(const status&) const { ++*n; }
+  int* n;
+};
+
+struct fail
+{
+  void operator()(const status&) const { throw std::runtime_error("continuation"); }
+};
+
+int
+test_chain(const communicator& comm)
+{
+  int failed = 0;
+  int right = (comm.rank() + 1) % comm.size();
+  int left  = (comm.rank() + comm.size() - 1) % comm.size();
+
+  completion_queue queue;
+  chain c(comm, queue);
+  c.post();
+  int sent = 0;
+  std::vector<int> out(rounds);
+  for (int i = 0; i < rounds; ++i) {
+    out[i] = comm.rank() * rounds + i;
+    queue.push(comm.isend(right, 0, out[i]), count(sent));
+  }
+  std::size_t completed = queue.run();
+  BOOST_MPI_CHECK(completed == std::size_t(2 * rounds) && queue.empty(), failed);
+  BOOST_MPI_CHECK(c.received == rounds && sent == rounds, failed);
+  BOOST_MPI_CHECK(c.sum == left * rounds * rounds + rounds * (rounds - 1) / 2, failed);
+  return failed;
+}
+
+int
+test_serialized(const communicator& comm)
+{
+  int failed = 0;
+  int right = (comm.rank() + 1) % comm.size();
+  int left  = (comm.rank() + comm.size() - 1) % comm.size();
+  int const n = 20;
+
+  completion_queue queue;
+  std::vector<std::string> in(n);
+  int matched = 0;
+  for (int i = 0; i < n; ++i)
+    queue.push(comm.irecv(left, i, in[i]), check_value(in[i], value(left, i), matched));
+  for (int i = n - 1; i >= 0; --i)
+    queue.push(comm.isend(right, i, value(comm.rank(), i)));
+  BOOST_MPI_CHECK(queue.size() == std::size_t(2 * n), failed);
+  while (!queue.empty())
+    queue.wait_some();
+  BOOST_MPI_CHECK(matched == n, failed);
+  return failed;
+}
+
+int
+test_inactive(const communicator& comm)
+{
+  int failed = 0;
+  completion_queue queue;
+  BOOST_MPI_CHECK(queue.wait_some() == 0 && queue.run() == 0, failed);
+
+  // An empty request is already complete.
+  int n = 0;
+  queue.push(request(), count(n));
+  BOOST_MPI_CHECK(queue.size() == 1 && n == 0, failed);
+  BOOST_MPI_CHECK(queue.poll() == 1 && n == 1 && queue.empty(), failed);
+
+  // An exception leaves the other continuations for the next drain.
+  queue.push(request(), fail());
+  queue.push(request(), count(n));
+  bool thrown = false;
+  try {
+    queue.poll();
+  } catch (std::runtime_error&) {
+    thrown = true;
+  }
+  BOOST_MPI_CHECK(thrown && queue.size() == 1 && n == 1, failed);
+  BOOST_MPI_CHECK(queue.poll() == 1 && n == 2, failed);
+
+  // A request completed through the copy kept by the caller is done.
+  int in = -1;
+  request recv = comm.irecv(comm.rank(), 0, in);
+  queue.push(recv, count(n));
+  request send = comm.isend(comm.rank(), 0, 5);
+  recv.wait();
+  send.wait();
+  BOOST_MPI_CHECK(queue.wait_some() == 1 && n == 3 && queue.empty() && in == 5, failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_chain(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_serialized(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_inactive(world), failed);
+  return failed;
+}
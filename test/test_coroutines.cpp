@@ -0,0 +1,137 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the coroutines that wait for communications with
+// co_await.
+#include <boost/mpi/coroutine.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+
+#include "mpi_test_utils.hpp"
+
+#if defined(BOOST_MPI_HAS_COROUTINES)
+
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using boost::mpi::async_scheduler;
+using boost::mpi::async_task;
+using boost::mpi::communicator;
+
+std::string
+value(int rank, int k)
+{
+  return boost::lexical_cast<std::string>(rank) + ":" + std::string(k % 20 * 10, 'z');
+}
+
+// Pass a value around the ring, on a tag of its own.
+async_task
+exchange(communicator comm, int k, int& received)
+{
+  int right = (comm.rank() + 1) % comm.size();
+  int left  = (comm.rank() + comm.size() - 1) % comm.size();
+  // A request is awaitable.
+  int in = -1;
+  boost::mpi::request recv = comm.irecv(left, k, in);
+  co_await comm.isend(right, k, 100 * comm.rank() + k);
+  boost::mpi::status stat = co_await recv;
+  received += stat.source() == left && in == 100 * left + k;
+
+  // So are the serialized receives and sends.
+  boost::mpi::request send = comm.isend(right, 1000 + k, value(comm.rank(), k));
+  std::string s = co_await boost::mpi::async_recv<std::string>(comm, left, 1000 + k);
+  co_await send;
+  received += s == value(left, k);
+  // A send may not complete before its receive is posted: post the
+  // receive first.
+  std::string forwarded;
+  boost::mpi::request forward = comm.irecv(left, 2000 + k, forwarded);
+  co_await boost::mpi::async_send(comm, right, 2000 + k, s);
+  co_await forward;
+  s = forwarded;
+  int second = (comm.rank() + 2 * comm.size() - 2) % comm.size();
+  received += s == value(second, k);
+}
+
+#if BOOST_MPI_VERSION >= 3
+async_task
+collectives(communicator comm, int& received)
+{
+  co_await boost::mpi::async_barrier(comm);
+  int rank = comm.rank();
+  int sum = 0;
+  co_await boost::mpi::async_all_reduce(comm, &rank, 1, &sum, std::plus<int>());
+  received += sum == comm.size() * (comm.size() - 1) / 2;
+  int root_value[2] = { rank, -rank };
+  co_await boost::mpi::async_broadcast(comm, root_value, 2, 0);
+  received += root_value[0] == 0 && root_value[1] == 0;
+}
+#endif
+
+async_task
+failing(communicator comm)
+{
+  int back = -1;
+  boost::mpi::request recv = comm.irecv(comm.rank(), 3000, back);
+  co_await boost::mpi::async_send(comm, comm.rank(), 3000, 1);
+  co_await recv;
+  throw std::runtime_error(boost::lexical_cast<std::string>(back));
+}
+
+int
+test_exchanges(const communicator& comm)
+{
+  int failed = 0;
+  int const ntasks = 200;
+  int received = 0;
+  async_scheduler scheduler;
+  for (int k = 0; k < ntasks; ++k)
+    scheduler.spawn(exchange(comm, k, received));
+  BOOST_MPI_CHECK(scheduler.size() == std::size_t(ntasks), failed);
+  scheduler.run();
+  BOOST_MPI_CHECK(received == 3 * ntasks && scheduler.size() == 0, failed);
+
+#if BOOST_MPI_VERSION >= 3
+  received = 0;
+  scheduler.spawn(collectives(comm, received));
+  scheduler.run();
+  BOOST_MPI_CHECK(received == 2, failed);
+#endif
+
+  // An exception ends its coroutine, and comes out of the scheduler.
+  scheduler.spawn(failing(comm));
+  std::string what;
+  try {
+    scheduler.run();
+  } catch (std::runtime_error& e) {
+    what = e.what();
+  }
+  BOOST_MPI_CHECK(what == "1" && scheduler.size() == 0, failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_exchanges(world), failed);
+  return failed;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,186 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the distributed graph communicator and of the neighborhood
+// collectives, on a ring where each process receives from its left
+// neighbor and sends to its right and left neighbors.
+#include <boost/mpi/dist_graph_communicator.hpp>
+#include <boost/mpi/cartesian_communicator.hpp>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/iteration_macros.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::mpi::dist_graph_communicator;
+using namespace boost;
+
+#if BOOST_MPI_VERSION >= 3
+
+int
+test_topology(const communicator& world)
+{
+  int failed = 0;
+  int size  = world.size();
+  int left  = (world.rank() + size - 1) % size;
+  int right = (world.rank() + 1) % size;
+
+  std::vector<int> sources(1, left);
+  std::vector<int> destinations;
+  destinations.push_back(right);
+  destinations.push_back(left);
+  std::vector<int> source_weights(1, 3);
+  std::vector<int> destination_weights;
+  destination_weights.push_back(3);
+  destination_weights.push_back(1);
+
+  dist_graph_communicator plain(world, std::vector<int>(1, left),
+                                std::vector<int>(1, right));
+  BOOST_MPI_CHECK(!plain.is_weighted(), failed);
+  BOOST_MPI_CHECK(plain.in_degree() == 1 && plain.out_degree() == 1, failed);
+  BOOST_MPI_CHECK(plain.sources()[0] == left, failed);
+  BOOST_MPI_CHECK(plain.destinations()[0] == right, failed);
+
+  dist_graph_communicator ring(world, sources, source_weights,
+                               destinations, destination_weights);
+  BOOST_MPI_CHECK(ring.has_dist_graph_topology(), failed);
+  BOOST_MPI_CHECK(!world.has_dist_graph_topology(), failed);
+  BOOST_MPI_CHECK(ring.is_weighted(), failed);
+  BOOST_MPI_CHECK(ring.sources() == sources, failed);
+  BOOST_MPI_CHECK(ring.destinations() == destinations, failed);
+  BOOST_MPI_CHECK(ring.source_weights() == source_weights, failed);
+  BOOST_MPI_CHECK(ring.destination_weights() == destination_weights, failed);
+
+  // The "cast" shares the same MPI communicator and neighborhood
+  communicator as_comm = ring;
+  optional<dist_graph_communicator> cast = as_comm.as_dist_graph_communicator();
+  BOOST_MPI_CHECK(bool(cast), failed);
+  BOOST_MPI_CHECK(cast && *cast == ring && cast->destinations() == destinations, failed);
+  BOOST_MPI_CHECK(!world.as_dist_graph_communicator(), failed);
+
+  // BGL view of the local neighborhood
+  int me = ring.rank();
+  BOOST_MPI_CHECK(num_vertices(ring) == size, failed);
+  BOOST_MPI_CHECK(out_degree(me, ring) == 2 && in_degree(me, ring) == 1, failed);
+  BOOST_MPI_CHECK(degree(me, ring) == 3, failed);
+  int i = 0;
+  BGL_FORALL_OUTEDGES(me, e, ring, dist_graph_communicator) {
+    BOOST_MPI_CHECK(source(e, ring) == me && target(e, ring) == destinations[i++], failed);
+  }
+  BGL_FORALL_INEDGES(me, e, ring, dist_graph_communicator) {
+    BOOST_MPI_CHECK(source(e, ring) == left && target(e, ring) == me, failed);
+  }
+  BOOST_MPI_CHECK(std::vector<int>(adjacent_vertices(me, ring).first,
+                                   adjacent_vertices(me, ring).second) == destinations,
+                  failed);
+  return failed;
+}
+
+int
+test_neighbor_collectives(const communicator& world)
+{
+  int failed = 0;
+  int size  = world.size();
+  int left  = (world.rank() + size - 1) % size;
+  int right = (world.rank() + 1) % size;
+
+  // Receive from both sides, send to both sides
+  std::vector<int> neighbors;
+  neighbors.push_back(left);
+  neighbors.push_back(right);
+  dist_graph_communicator ring(world, neighbors, neighbors);
+
+  std::vector<int> ints;
+  mpi::neighbor_all_gather(ring, ring.rank(), ints);
+  BOOST_MPI_CHECK(ints == neighbors, failed);
+
+  std::vector<std::string> strings;
+  mpi::neighbor_all_gather(ring, lexical_cast<std::string>(ring.rank()), strings);
+  BOOST_MPI_CHECK(strings.size() == 2
+                  && strings[0] == lexical_cast<std::string>(left)
+                  && strings[1] == lexical_cast<std::string>(right), failed);
+
+  // Two values per neighbor
+  int pair[2] = { ring.rank(), -ring.rank() };
+  mpi::neighbor_all_gather(ring, pair, 2, ints);
+  BOOST_MPI_CHECK(ints.size() == 4 && ints[0] == left && ints[1] == -left
+                  && ints[2] == right && ints[3] == -right, failed);
+
+  // Send "rank:destination" to each destination, so that each process
+  // receives "source:rank" from each source.
+  std::vector<std::string> out_strings;
+  std::vector<int> out_ints;
+  for (int d = 0; d < 2; ++d) {
+    out_strings.push_back(lexical_cast<std::string>(ring.rank()) + ":"
+                          + lexical_cast<std::string>(neighbors[d]));
+    out_ints.push_back(ring.rank() * size + neighbors[d]);
+  }
+  std::vector<std::string> in_strings;
+  std::vector<int> in_ints;
+  mpi::neighbor_all_to_all(ring, out_strings, in_strings);
+  mpi::neighbor_all_to_all(ring, out_ints, in_ints);
+  for (int s = 0; s < 2; ++s) {
+    BOOST_MPI_CHECK(in_strings[s] == (lexical_cast<std::string>(neighbors[s]) + ":"
+                                      + lexical_cast<std::string>(ring.rank())), failed);
+    BOOST_MPI_CHECK(in_ints[s] == neighbors[s] * size + ring.rank(), failed);
+  }
+
+  // The neighborhood collectives also work on cartesian topologies
+  mpi::cartesian_dimension dims[] = {{size, true}};
+  mpi::cartesian_communicator cart(world, mpi::cartesian_topology(dims));
+  mpi::neighbor_all_gather(cart, cart.rank(), ints);
+  BOOST_MPI_CHECK(ints.size() == 2 && ints[0] == left && ints[1] == right, failed);
+
+  // Without periodicity, the neighbors beyond the borders are
+  // MPI_PROC_NULL, and their values are left untouched.
+  mpi::cartesian_dimension open_dims[] = {{size, false}};
+  mpi::cartesian_communicator line(world, mpi::cartesian_topology(open_dims));
+  std::string const none("none");
+  std::string const expected[2] = {
+    line.rank() > 0 ? lexical_cast<std::string>(line.rank() - 1) : none,
+    line.rank() < size - 1 ? lexical_cast<std::string>(line.rank() + 1) : none
+  };
+  strings.assign(2, none);
+  mpi::neighbor_all_gather(line, lexical_cast<std::string>(line.rank()), &strings[0]);
+  BOOST_MPI_CHECK(strings[0] == expected[0] && strings[1] == expected[1], failed);
+  out_strings.assign(2, lexical_cast<std::string>(line.rank()));
+  in_strings.assign(2, none);
+  mpi::neighbor_all_to_all(line, &out_strings[0], &in_strings[0]);
+  BOOST_MPI_CHECK(in_strings[0] == expected[0] && in_strings[1] == expected[1], failed);
+  return failed;
+}
+
+int main()
+{
+  boost::function_requires< IncidenceGraphConcept<dist_graph_communicator> >();
+  boost::function_requires< BidirectionalGraphConcept<dist_graph_communicator> >();
+  boost::function_requires< AdjacencyGraphConcept<dist_graph_communicator> >();
+  boost::function_requires< VertexListGraphConcept<dist_graph_communicator> >();
+
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_topology(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_neighbor_collectives(world), failed);
+  return failed;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
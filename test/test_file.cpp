@@ -0,0 +1,248 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the MPI-IO file wrapper: typed collective and independent
+// accesses, views, distributed arrays and serialized checkpoints.
+#include <boost/mpi/file.hpp>
+#include <boost/mpi/cartesian_communicator.hpp>
+#include <boost/mpi/distributed_array.hpp>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/lexical_cast.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::mpi::file;
+using boost::lexical_cast;
+
+template<typename T>
+T*
+data_of(std::vector<T>& v)
+{
+  return v.empty() ? static_cast<T*>(0) : &v[0];
+}
+
+// Distinct for each number of processes, as the tests may run
+// concurrently.
+std::string
+filename(const communicator& comm, const char* what)
+{
+  return std::string("test_file_") + what + "_" + lexical_cast<std::string>(comm.size());
+}
+
+void
+remove(const communicator& comm, const std::string& name)
+{
+  comm.barrier();
+  if (comm.rank() == 0)
+    MPI_File_delete(const_cast<char*>(name.c_str()), MPI_INFO_NULL);
+  comm.barrier();
+}
+
+int
+test_typed(const communicator& world)
+{
+  int failed = 0;
+  int size = world.size();
+  int rank = world.rank();
+  int const n = 5;
+  std::string name = filename(world, "typed");
+
+  std::vector<int> values(n);
+  for (int i = 0; i < n; ++i)
+    values[i] = rank * n + i;
+  {
+    file out(world, name, MPI_MODE_CREATE | MPI_MODE_WRONLY);
+    BOOST_MPI_CHECK(bool(out), failed);
+    out.set_view<int>(0);
+    boost::mpi::status stat = out.write_at_all(rank * n, &values[0], n);
+    BOOST_MPI_CHECK(stat.count<int>() && *stat.count<int>() == n, failed);
+    out.sync();
+    file copy = out;
+    copy.close();
+    BOOST_MPI_CHECK(!out && MPI_File(out) == MPI_FILE_NULL, failed);
+    // Closing again, or a file never opened, does nothing.
+    out.close();
+    file none;
+    none.close();
+  }
+
+  file in(world, name, MPI_MODE_RDONLY);
+  BOOST_MPI_CHECK(in.size() == MPI_Offset(size * n * sizeof(int)), failed);
+  in.set_view<int>(0);
+  // Read the values of the next process, collectively, then of the
+  // previous one, independently.
+  int next = (rank + 1) % size;
+  std::vector<int> read(n, -1);
+  in.read_at_all(next * n, &read[0], n);
+  bool ok = true;
+  for (int i = 0; i < n; ++i)
+    ok = ok && read[i] == next * n + i;
+  BOOST_MPI_CHECK(ok, failed);
+  int prev = (rank + size - 1) % size;
+  int last = -1;
+  in.read_at(prev * n + n - 1, &last, 1);
+  BOOST_MPI_CHECK(last == prev * n + n - 1, failed);
+  in.close();
+  remove(world, name);
+  return failed;
+}
+
+int
+test_serialized(const communicator& world)
+{
+  int failed = 0;
+  int rank = world.rank();
+  std::string name = filename(world, "serialized");
+
+  // Archives of very different sizes, one of them empty.
+  std::vector<std::string> state;
+  for (int i = 0; i < rank * 100; ++i)
+    state.push_back(lexical_cast<std::string>(rank) + ":" + lexical_cast<std::string>(i));
+  {
+    file ckpt(world, name, MPI_MODE_CREATE | MPI_MODE_WRONLY);
+    ckpt.write_serialized_all(state);
+  }
+
+  std::vector<std::string> restored(3, "garbage");
+  file restart(world, name, MPI_MODE_RDONLY);
+  restart.read_serialized_all(restored);
+  BOOST_MPI_CHECK(restored == state, failed);
+  restart.close();
+
+  // The number of processes is checked.
+  if (world.size() > 1) {
+    communicator half = world.split(rank % 2);
+    file other(half, name, MPI_MODE_RDONLY);
+    bool thrown = false;
+    try {
+      other.read_serialized_all(restored);
+    } catch (const boost::mpi::exception&) {
+      thrown = true;
+    }
+    BOOST_MPI_CHECK(thrown, failed);
+  }
+  remove(world, name);
+  return failed;
+}
+
+// The global index of local index l along a dimension.
+int
+global_index(int l, const boost::mpi::array_dimension& dim, int nprocs, int coord)
+{
+  int block = dim.block;
+  if (dim.distribution == boost::mpi::distribute_block) {
+    if (block == 0)
+      block = (dim.size + nprocs - 1) / nprocs;
+    return coord * block + l;
+  } else {
+    if (block == 0)
+      block = 1;
+    return ((l / block) * nprocs + coord) * block + l % block;
+  }
+}
+
+// Check a local part of the 2-d array whose element (i,j) is 1000*i+j.
+bool
+check_array(const std::vector<int>& local, const boost::mpi::distributed_array_layout& layout,
+            const std::vector<boost::mpi::array_dimension>& dims,
+            const std::vector<int>& grid, const std::vector<int>& coords)
+{
+  std::vector<int> const& sizes = layout.local_sizes();
+  bool ok = local.size() == layout.local_size();
+  for (int l0 = 0; ok && l0 < sizes[0]; ++l0) {
+    for (int l1 = 0; ok && l1 < sizes[1]; ++l1) {
+      int i = global_index(l0, dims[0], grid[0], coords[0]);
+      int j = global_index(l1, dims[1], grid[1], coords[1]);
+      ok = i < dims[0].size && j < dims[1].size
+        && local[l0 * sizes[1] + l1] == 1000 * i + j;
+    }
+  }
+  return ok;
+}
+
+int
+test_arrays(const communicator& world)
+{
+  using boost::mpi::array_dimension;
+  using boost::mpi::distributed_array_layout;
+  int failed = 0;
+  int rank = world.rank();
+  std::string name = filename(world, "array");
+  int const rows = 13;
+  int const cols = 7;
+  MPI_Offset const header = 16;
+
+  // Process 0 writes a block of rows, the others nothing.
+  std::vector<int> global_sizes;
+  global_sizes.push_back(rows);
+  global_sizes.push_back(cols);
+  std::vector<int> mine(2, 0);
+  std::vector<int> starts(2, 0);
+  if (rank == 0)
+    mine = global_sizes;
+  distributed_array_layout single(global_sizes, mine, starts);
+  BOOST_MPI_CHECK(single.local_size() == std::size_t(rank == 0 ? rows * cols : 0), failed);
+  std::vector<int> all(single.local_size());
+  for (std::size_t k = 0; k < all.size(); ++k)
+    all[k] = 1000 * int(k / cols) + int(k % cols);
+  {
+    file out(world, name, MPI_MODE_CREATE | MPI_MODE_WRONLY);
+    out.write_array_all(single, data_of(all), header);
+  }
+  file in(world, name, MPI_MODE_RDONLY);
+  BOOST_MPI_CHECK(in.size() == header + MPI_Offset(rows * cols * sizeof(int)), failed);
+
+  // Read it back over a 2-d grid, by blocks and cyclically.
+  std::vector<int> grid(2, 0);
+  boost::mpi::cartesian_dimensions(world.size(), grid);
+  boost::mpi::cartesian_dimension grid_dims[] = {{grid[0], false}, {grid[1], false}};
+  boost::mpi::cartesian_communicator cart(world, boost::mpi::cartesian_topology(grid_dims));
+  std::vector<int> coords = cart.coordinates(cart.rank());
+
+  std::vector<array_dimension> blocks;
+  blocks.push_back(array_dimension(rows));
+  blocks.push_back(array_dimension(cols));
+  distributed_array_layout by_block(cart, blocks);
+  std::vector<int> local(by_block.local_size(), -1);
+  in.read_array_all(by_block, data_of(local), header);
+  BOOST_MPI_CHECK(check_array(local, by_block, blocks, grid, coords), failed);
+
+  std::vector<array_dimension> cyclic;
+  cyclic.push_back(array_dimension(rows, boost::mpi::distribute_cyclic, 2));
+  cyclic.push_back(array_dimension(cols, boost::mpi::distribute_cyclic));
+  distributed_array_layout by_cycle(cart, cyclic);
+  local.assign(by_cycle.local_size(), -1);
+  in.read_array_all(by_cycle, data_of(local), header);
+  BOOST_MPI_CHECK(check_array(local, by_cycle, cyclic, grid, coords), failed);
+
+  // Every element is read exactly once.
+  std::size_t total = boost::mpi::all_reduce(world, by_cycle.local_size(), std::plus<std::size_t>());
+  BOOST_MPI_CHECK(total == std::size_t(rows * cols), failed);
+  in.close();
+  remove(world, name);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_CHECK(!file(), failed);
+  BOOST_MPI_COUNT_FAILED(test_typed(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_arrays(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_serialized(world), failed);
+  return failed;
+}
@@ -104,6 +104,20 @@ int main()
   BOOST_MPI_CHECK((int)num_vertices(graph) == num_vertices(graph_comm), failed);
   BOOST_MPI_CHECK((int)num_edges(graph) == num_edges(graph_comm), failed);
 
+  // The edge list and the incidence lists walk the same cached
+  // topology, which is shared by the copies of the communicator
+  graph_communicator graph_copy = graph_comm;
+  int nedges = 0, degrees = 0;
+  BGL_FORALL_EDGES(e, graph_copy, graph_communicator) {
+    ++nedges;
+    BGL_FORALL_ADJ(source(e, graph_copy), v, graph_comm, graph_communicator) {
+      if (v == target(e, graph_copy)) { ++degrees; break; }
+    }
+  }
+  BGL_FORALL_VERTICES(v, graph_comm, graph_communicator)
+    degrees -= out_degree(v, graph_comm);
+  BOOST_MPI_CHECK(nedges == num_edges(graph_comm) && degrees == 0, failed);
+
   // Display the communicator graph
   if (graph_comm.rank() == 0) {
     std::cout << "Communicator graph:\n";
@@ -0,0 +1,141 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the two level (node, then node leaders) serialized
+// collectives. Nodes are emulated by splitting the communicator, with
+// either consecutive or interleaved ranks.
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/operations.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::lexical_cast;
+
+#if BOOST_MPI_VERSION >= 3
+
+// A commutative operation on a serialized type.
+struct string_max
+{
+  std::string operator()(const std::string& x, const std::string& y) const
+  {
+    return x < y ? y : x;
+  }
+};
+
+namespace boost { namespace mpi {
+template<>
+struct is_commutative<string_max, std::string> : mpl::true_ { };
+} } // end namespace boost::mpi
+
+std::string
+value(int rank)
+{
+  return "<" + lexical_cast<std::string>(rank) + ">";
+}
+
+int
+test_collectives(const communicator& comm)
+{
+  int failed = 0;
+  int size = comm.size();
+  int rank = comm.rank();
+
+  std::string all;
+  for (int p = 0; p < size; ++p)
+    all += value(p);
+
+  for (int root = 0; root < size; ++root) {
+    std::string bcast = rank == root ? value(root) : std::string();
+    boost::mpi::broadcast(comm, bcast, root);
+    BOOST_MPI_CHECK(bcast == value(root), failed);
+
+    std::vector<std::string> gathered;
+    boost::mpi::gather(comm, value(rank), gathered, root);
+    if (rank == root) {
+      bool ok = int(gathered.size()) == size;
+      for (int p = 0; ok && p < size; ++p)
+        ok = gathered[p] == value(p);
+      BOOST_MPI_CHECK(ok, failed);
+    }
+  }
+
+  // Non-commutative, only two levels with consecutive ranks
+  std::string concat = boost::mpi::all_reduce(comm, value(rank), std::plus<std::string>());
+  BOOST_MPI_CHECK(concat == all, failed);
+
+  std::string in_place = value(rank);
+  boost::mpi::all_reduce(comm, boost::mpi::inplace(in_place), std::plus<std::string>());
+  BOOST_MPI_CHECK(in_place == all, failed);
+
+  std::string max = boost::mpi::all_reduce(comm, value(rank), string_max());
+  std::string expected_max;
+  for (int p = 0; p < size; ++p)
+    expected_max = string_max()(expected_max, value(p));
+  BOOST_MPI_CHECK(max == expected_max, failed);
+
+  std::string prefix = boost::mpi::scan(comm, value(rank), std::plus<std::string>());
+  std::string expected_prefix;
+  for (int p = 0; p <= rank; ++p)
+    expected_prefix += value(p);
+  BOOST_MPI_CHECK(prefix == expected_prefix, failed);
+
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+  int failed = 0;
+
+  // All the processes of the test run on the same host.
+  communicator node = world.node_communicator();
+  BOOST_MPI_CHECK(node.size() == world.split_shared().size(), failed);
+  BOOST_MPI_CHECK(bool(world.node_leaders_communicator()) == (node.rank() == 0), failed);
+  world.enable_hierarchical_collectives();
+  BOOST_MPI_COUNT_FAILED(test_collectives(world), failed);
+  world.enable_hierarchical_collectives(false);
+  BOOST_MPI_CHECK(!world.hierarchical_collectives_enabled(), failed);
+
+  int group = std::max(world.size() / 3, 1);
+  communicator blocks(world, boost::mpi::comm_duplicate);
+  blocks.enable_hierarchical_collectives(blocks.split(blocks.rank() / group));
+  communicator copy = blocks;
+  BOOST_MPI_CHECK(copy.hierarchical_collectives_enabled()
+                  == (world.size() > 1 && group > 1), failed);
+  BOOST_MPI_COUNT_FAILED(test_collectives(copy), failed);
+
+  communicator interleaved(world, boost::mpi::comm_duplicate);
+  interleaved.enable_hierarchical_collectives(interleaved.split(interleaved.rank() % 3));
+  BOOST_MPI_COUNT_FAILED(test_collectives(interleaved), failed);
+
+  // The shared memory nodes are cached next to a custom grouping:
+  // only the first call is collective.
+  node = interleaved.node_communicator();
+  if (interleaved.rank() == 0) {
+    BOOST_MPI_CHECK(interleaved.node_communicator() == node, failed);
+    BOOST_MPI_CHECK(bool(interleaved.node_leaders_communicator()), failed);
+  }
+
+  return failed;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,107 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the progress engine, which advances the non-blocking
+// receives of serialized data outside of their test() and wait().
+#include <boost/mpi/progress.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/exception.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/lexical_cast.hpp>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::mpi::request;
+
+std::string
+value(int rank)
+{
+  return boost::lexical_cast<std::string>(rank) + std::string(10000, 'x');
+}
+
+int
+test_manual(const communicator& comm)
+{
+  int failed = 0;
+  int right = (comm.rank() + 1) % comm.size();
+  int left  = (comm.rank() + comm.size() - 1) % comm.size();
+
+  boost::mpi::start_progress(boost::mpi::progress_manual);
+  BOOST_MPI_CHECK(boost::mpi::current_progress_mode() == boost::mpi::progress_manual, failed);
+  std::string in;
+  request reqs[2];
+  reqs[0] = comm.irecv(left, 0, in);
+  reqs[1] = comm.isend(right, 0, value(comm.rank()));
+  while (boost::mpi::progress() == 0)
+    ;
+  // The value is there before the request is tested, which still
+  // reports it.
+  BOOST_MPI_CHECK(in == value(left), failed);
+  BOOST_MPI_CHECK(reqs[0].active(), failed);
+  BOOST_MPI_CHECK(boost::mpi::wait_any(reqs, reqs + 1).second == reqs, failed);
+  BOOST_MPI_CHECK(!reqs[0].active(), failed);
+  reqs[1].wait();
+
+  // Nothing left to advance.
+  BOOST_MPI_CHECK(boost::mpi::progress() == 0, failed);
+  boost::mpi::stop_progress();
+  BOOST_MPI_CHECK(boost::mpi::current_progress_mode() == boost::mpi::progress_none, failed);
+  return failed;
+}
+
+int
+test_background(const communicator& comm)
+{
+  int failed = 0;
+  int right = (comm.rank() + 1) % comm.size();
+  int left  = (comm.rank() + comm.size() - 1) % comm.size();
+
+  boost::mpi::start_progress(boost::mpi::progress_background, 10);
+  std::vector<request> reqs;
+  std::vector<std::vector<int> > in(8);
+  std::vector<std::vector<int> > out(8);
+  for (int i = 0; i < 8; ++i) {
+    out[i].assign(1000 * (i + 1), comm.rank() + i);
+    reqs.push_back(comm.irecv(left, i, in[i]));
+    reqs.push_back(comm.isend(right, i, out[i]));
+  }
+  boost::mpi::wait_all(reqs.begin(), reqs.end());
+  bool ok = true;
+  for (int i = 0; i < 8; ++i)
+    ok = ok && in[i] == std::vector<int>(1000 * (i + 1), left + i);
+  BOOST_MPI_CHECK(ok, failed);
+  boost::mpi::stop_progress();
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env(boost::mpi::threading::multiple);
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_manual(world), failed);
+  if (env.thread_level() == boost::mpi::threading::multiple) {
+    BOOST_MPI_COUNT_FAILED(test_background(world), failed);
+  } else {
+    // A thread of the library cannot call MPI.
+    bool thrown = false;
+    try {
+      boost::mpi::start_progress(boost::mpi::progress_background);
+    } catch (boost::mpi::exception&) {
+      thrown = true;
+    }
+    BOOST_MPI_CHECK(thrown, failed);
+  }
+  return failed;
+}
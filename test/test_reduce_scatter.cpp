@@ -0,0 +1,144 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the reduce_scatter() and reduce_scatter_block() collectives.
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/operations.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+
+// A point with an MPI datatype but no built-in MPI operation.
+struct point
+{
+  point() : x(0), y(0), z(0) { }
+  point(int x, int y, int z) : x(x), y(y), z(z) { }
+
+  int x;
+  int y;
+  int z;
+
+ private:
+  template<typename Archiver>
+  void serialize(Archiver& ar, unsigned int /*version*/)
+  {
+    ar & x & y & z;
+  }
+
+  friend class boost::serialization::access;
+};
+
+bool operator==(const point& p1, const point& p2)
+{
+  return p1.x == p2.x && p1.y == p2.y && p1.z == p2.z;
+}
+
+point operator+(const point& p1, const point& p2)
+{
+  return point(p1.x + p2.x, p1.y + p2.y, p1.z + p2.z);
+}
+
+namespace boost { namespace mpi {
+
+  template <>
+  struct is_mpi_datatype<point> : public mpl::true_ { };
+
+} } // end namespace boost::mpi
+
+struct int_generator
+{
+  typedef int result_type;
+  int operator()(int rank, int i) const { return 100 * rank + i; }
+};
+
+struct point_generator
+{
+  typedef point result_type;
+  point operator()(int rank, int i) const { return point(rank, i, rank * i); }
+};
+
+struct string_generator
+{
+  typedef std::string result_type;
+  std::string operator()(int rank, int i) const
+  {
+    return boost::lexical_cast<std::string>(rank) + ':' + boost::lexical_cast<std::string>(i) + ' ';
+  }
+};
+
+// The element i of the result, combined in rank order.
+template<typename Generator, typename Op>
+typename Generator::result_type
+expected(const communicator& comm, Generator generator, Op op, int i)
+{
+  typename Generator::result_type result = generator(0, i);
+  for (int p = 1; p < comm.size(); ++p)
+    result = op(result, generator(p, i));
+  return result;
+}
+
+template<typename Generator, typename Op>
+int
+reduce_scatter_test(const communicator& comm, Generator generator, Op op)
+{
+  typedef typename Generator::result_type value_type;
+  int failed = 0;
+  int size = comm.size();
+  int rank = comm.rank();
+
+  // Blocks of different sizes, some of them empty.
+  std::vector<int> sizes(size);
+  int total = 0;
+  int first = 0;
+  for (int p = 0; p < size; ++p) {
+    sizes[p] = (p + 1) % 3;
+    if (p == rank)
+      first = total;
+    total += sizes[p];
+  }
+  std::vector<value_type> in_values;
+  for (int i = 0; i < total; ++i)
+    in_values.push_back(generator(rank, i));
+  std::vector<value_type> out_values;
+  boost::mpi::reduce_scatter(comm, in_values, sizes, out_values, op);
+  bool ok = int(out_values.size()) == sizes[rank];
+  for (int i = 0; ok && i < sizes[rank]; ++i)
+    ok = out_values[i] == expected(comm, generator, op, first + i);
+  BOOST_MPI_CHECK(ok, failed);
+
+  // Blocks of two elements.
+  in_values.clear();
+  for (int i = 0; i < 2 * size; ++i)
+    in_values.push_back(generator(rank, i));
+  boost::mpi::reduce_scatter_block(comm, in_values, out_values, op);
+  ok = out_values.size() == 2;
+  for (int i = 0; ok && i < 2; ++i)
+    ok = out_values[i] == expected(comm, generator, op, 2 * rank + i);
+  BOOST_MPI_CHECK(ok, failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator comm;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(reduce_scatter_test(comm, int_generator(), std::plus<int>()), failed);
+  BOOST_MPI_COUNT_FAILED(reduce_scatter_test(comm, int_generator(), boost::mpi::maximum<int>()), failed);
+  BOOST_MPI_COUNT_FAILED(reduce_scatter_test(comm, point_generator(), std::plus<point>()), failed);
+  // Not commutative
+  BOOST_MPI_COUNT_FAILED(reduce_scatter_test(comm, string_generator(), std::plus<std::string>()), failed);
+  return failed;
+}
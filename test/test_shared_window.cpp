@@ -0,0 +1,127 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the shared memory windows: direct access to the segments
+// of the other processes of the node, and per node broadcast.
+#include <boost/mpi/shared_window.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::mpi::shared_window;
+
+#if BOOST_MPI_VERSION >= 3
+
+// Process p of the node owns p+1 values, all set to 100*p+i.
+bool
+check_segments(const shared_window<int>& win)
+{
+  bool ok = true;
+  for (int p = 0; p < win.node().size(); ++p) {
+    shared_window<int>::span s = win.segment(p);
+    ok = ok && int(s.size()) == p + 1;
+    for (int i = 0; ok && i <= p; ++i)
+      ok = s[i] == 100 * p + i;
+  }
+  return ok;
+}
+
+int
+test_segments(const communicator& world, bool contiguous)
+{
+  int failed = 0;
+  int me = world.node_communicator().rank();
+  shared_window<int> win(world, me + 1, contiguous);
+  BOOST_MPI_CHECK(bool(win) && MPI_Win(win) != MPI_WIN_NULL, failed);
+  BOOST_MPI_CHECK(win.node() == world.node_communicator(), failed);
+  BOOST_MPI_CHECK(win.local().data() == win.segment(me).data(), failed);
+
+  // Active target synchronization
+  win.fence();
+  for (int i = 0; i <= me; ++i)
+    win.local()[i] = 100 * me + i;
+  win.fence();
+  BOOST_MPI_CHECK(check_segments(win), failed);
+  win.fence(MPI_MODE_NOSUCCEED);
+
+  // Passive target synchronization: everybody bumps its left
+  // neighbor's values.
+  int n = win.node().size();
+  shared_window<int> copy = win;
+  copy.lock_all();
+  shared_window<int>::span left = copy.segment((me + n - 1) % n);
+  for (std::size_t i = 0; i < left.size(); ++i)
+    left[i] += 1;
+  copy.sync();
+  win.node().barrier();
+  copy.sync();
+  bool ok = true;
+  for (int i = 0; i <= me; ++i)
+    ok = ok && copy.local()[i] == 100 * me + i + 1;
+  BOOST_MPI_CHECK(ok, failed);
+  copy.unlock_all();
+  return failed;
+}
+
+int
+test_broadcast(const communicator& world)
+{
+  int failed = 0;
+  std::size_t const n = 1000;
+  bool leader = world.node_communicator().rank() == 0;
+
+  // One copy of the table per node
+  shared_window<double> table(world, leader ? n : 0);
+  if (world.rank() == 0) {
+    for (std::size_t i = 0; i < n; ++i)
+      table.local()[i] = double(i) / 2;
+  }
+  table.broadcast(0);
+  shared_window<double>::span values = table.segment(0);
+  bool ok = values.size() == n;
+  for (std::size_t i = 0; ok && i < n; ++i)
+    ok = values[i] == double(i) / 2;
+  BOOST_MPI_CHECK(ok, failed);
+
+  // From a process that is not a node leader, to every node leader
+  int root = world.size() - 1;
+  shared_window<int> all(world, n);
+  if (world.rank() == root) {
+    for (std::size_t i = 0; i < n; ++i)
+      all.local()[i] = int(i) * root;
+  }
+  all.broadcast(root);
+  ok = true;
+  for (std::size_t i = 0; ok && i < n; ++i)
+    ok = all.segment(0)[i] == int(i) * root;
+  BOOST_MPI_CHECK(ok, failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_CHECK(!shared_window<int>(), failed);
+  BOOST_MPI_COUNT_FAILED(test_segments(world, true), failed);
+  BOOST_MPI_COUNT_FAILED(test_segments(world, false), failed);
+  BOOST_MPI_COUNT_FAILED(test_broadcast(world), failed);
+  return failed;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
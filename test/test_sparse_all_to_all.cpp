@@ -0,0 +1,131 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the sparse_all_to_all() collective.
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+
+#if BOOST_MPI_VERSION >= 3
+
+// Process src sends to process (src + 1) and (src + 3), in round
+// round.
+std::vector<int>
+destinations(const communicator& comm, int src, int round)
+{
+  std::vector<int> dests;
+  dests.push_back((src + 1 + round) % comm.size());
+  if ((src + 3 + round) % comm.size() != dests[0])
+    dests.push_back((src + 3 + round) % comm.size());
+  return dests;
+}
+
+std::vector<int>
+sources(const communicator& comm, int dest, int round)
+{
+  std::vector<int> srcs;
+  for (int src = 0; src < comm.size(); ++src) {
+    std::vector<int> dests = destinations(comm, src, round);
+    if (std::find(dests.begin(), dests.end(), dest) != dests.end())
+      srcs.push_back(src);
+  }
+  return srcs;
+}
+
+struct int_generator
+{
+  typedef int result_type;
+  int operator()(int src, int dest, int round) const { return 1000 * src + 10 * dest + round; }
+};
+
+struct string_generator
+{
+  typedef std::string result_type;
+  std::string operator()(int src, int dest, int round) const
+  {
+    return boost::lexical_cast<std::string>(src) + "->" + boost::lexical_cast<std::string>(dest)
+      + std::string(round, '#');
+  }
+};
+
+// Arrays of a length that depends on the source and destination,
+// possibly empty.
+template<typename Generator>
+struct array_generator
+{
+  typedef std::vector<typename Generator::result_type> result_type;
+  result_type operator()(int src, int dest, int round) const
+  {
+    result_type values;
+    for (int i = 0; i < (src + dest + round) % 5; ++i)
+      values.push_back(Generator()(src, dest, round + i));
+    return values;
+  }
+};
+
+template<typename Generator>
+int
+sparse_all_to_all_test(const communicator& comm, Generator generator)
+{
+  typedef typename Generator::result_type value_type;
+  int failed = 0;
+  int rank = comm.rank();
+
+  // Several exchanges in a row, to check they do not mix up.
+  bool ok = true;
+  for (int round = 0; round < 8; ++round) {
+    std::map<int, value_type> outgoing, incoming;
+    std::vector<int> dests = destinations(comm, rank, round);
+    for (std::size_t i = 0; i < dests.size(); ++i)
+      outgoing[dests[i]] = generator(rank, dests[i], round);
+    incoming[-1] = value_type();
+    boost::mpi::sparse_all_to_all(comm, outgoing, incoming);
+    std::vector<int> srcs = sources(comm, rank, round);
+    ok = ok && incoming.size() == srcs.size();
+    for (std::size_t i = 0; ok && i < srcs.size(); ++i)
+      ok = incoming.count(srcs[i]) && incoming[srcs[i]] == generator(srcs[i], rank, round);
+  }
+  BOOST_MPI_CHECK(ok, failed);
+
+  // Nobody sends anything.
+  std::map<int, value_type> none;
+  boost::mpi::sparse_all_to_all(comm, std::map<int, value_type>(), none);
+  BOOST_MPI_CHECK(none.empty(), failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator comm;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(sparse_all_to_all_test(comm, int_generator()), failed);
+  BOOST_MPI_COUNT_FAILED(sparse_all_to_all_test(comm, string_generator()), failed);
+  BOOST_MPI_COUNT_FAILED(sparse_all_to_all_test(comm, array_generator<int_generator>()), failed);
+  BOOST_MPI_COUNT_FAILED(sparse_all_to_all_test(comm, array_generator<string_generator>()), failed);
+  return failed;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
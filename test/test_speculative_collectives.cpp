@@ -0,0 +1,138 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the single round (speculative slot) serialized gathers
+// and broadcasts, with values that fit in the slots and values that do
+// not.
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::lexical_cast;
+
+// The value of process rank, of about long_size bytes on the
+// processes selected by every, short otherwise.
+std::string
+value(int rank, int long_size, int every)
+{
+  std::string result = "<" + lexical_cast<std::string>(rank) + ">";
+  if (every > 0 && rank % every == 0)
+    result += std::string(long_size, char('a' + rank % 26));
+  return result;
+}
+
+int
+test_gathers(const communicator& comm, int long_size, int every)
+{
+  int failed = 0;
+  int size = comm.size();
+  int rank = comm.rank();
+  std::string mine = value(rank, long_size, every);
+
+  for (int root = 0; root < size; root += std::max(size - 1, 1)) {
+    std::vector<std::string> gathered;
+    boost::mpi::gather(comm, mine, gathered, root);
+    if (rank == root) {
+      bool ok = int(gathered.size()) == size;
+      for (int p = 0; ok && p < size; ++p)
+        ok = gathered[p] == value(p, long_size, every);
+      BOOST_MPI_CHECK(ok, failed);
+    }
+  }
+
+  std::vector<std::string> all;
+  boost::mpi::all_gather(comm, mine, all);
+  bool ok = int(all.size()) == size;
+  for (int p = 0; ok && p < size; ++p)
+    ok = all[p] == value(p, long_size, every);
+  BOOST_MPI_CHECK(ok, failed);
+
+  // Process p contributes p % 3 values.
+  std::vector<int> sizes(size);
+  std::vector<int> displs(size);
+  int total = 0;
+  for (int p = 0; p < size; ++p) {
+    displs[p] = total;
+    sizes[p] = p % 3;
+    total += sizes[p];
+  }
+  std::vector<std::string> in_values(sizes[rank], mine);
+  std::vector<std::string> out_values(total);
+  boost::mpi::all_gatherv(comm, in_values, out_values, sizes, displs);
+  ok = true;
+  for (int p = 0; ok && p < size; ++p)
+    for (int i = 0; ok && i < sizes[p]; ++i)
+      ok = out_values[displs[p] + i] == value(p, long_size, every);
+  BOOST_MPI_CHECK(ok, failed);
+  return failed;
+}
+
+int
+test_broadcasts(const communicator& comm, int long_size, int every)
+{
+  int failed = 0;
+  int size = comm.size();
+  int rank = comm.rank();
+
+  bool ok = true;
+  for (int root = 0; root < size; ++root) {
+    std::string received = rank == root ? value(root, long_size, every) : std::string();
+    boost::mpi::broadcast(comm, received, root);
+    ok = ok && received == value(root, long_size, every);
+
+    // Whatever the slot of the communicator
+    std::vector<std::string> hinted;
+    if (rank == root)
+      hinted.assign(3, value(root, long_size, every));
+    boost::mpi::broadcast(comm, hinted, root, 3 * long_size / 2);
+    ok = ok && hinted == std::vector<std::string>(3, value(root, long_size, every));
+  }
+  BOOST_MPI_CHECK(ok, failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+  int failed = 0;
+
+  communicator comm(world, boost::mpi::comm_duplicate);
+  BOOST_MPI_CHECK(comm.speculative_collectives_slot() == 0, failed);
+  comm.enable_speculative_collectives(64);
+  communicator copy = comm;
+  BOOST_MPI_CHECK(copy.speculative_collectives_slot() == 64, failed);
+  BOOST_MPI_CHECK(world.speculative_collectives_slot() == 0, failed);
+
+  // Everything fits
+  BOOST_MPI_COUNT_FAILED(test_gathers(copy, 0, 0), failed);
+  BOOST_MPI_COUNT_FAILED(test_broadcasts(copy, 0, 0), failed);
+  // Some processes, or all of them, need a second round
+  BOOST_MPI_COUNT_FAILED(test_gathers(copy, 100, 2), failed);
+  BOOST_MPI_COUNT_FAILED(test_gathers(copy, 1000, 1), failed);
+  BOOST_MPI_COUNT_FAILED(test_broadcasts(copy, 100, 2), failed);
+
+  // The smallest slot only holds the size and one byte.
+  comm.enable_speculative_collectives(1);
+  BOOST_MPI_CHECK(comm.speculative_collectives_slot() == int(sizeof(int)) + 1, failed);
+  BOOST_MPI_COUNT_FAILED(test_gathers(comm, 10, 3), failed);
+  BOOST_MPI_COUNT_FAILED(test_broadcasts(comm, 10, 3), failed);
+
+  comm.enable_speculative_collectives(0);
+  BOOST_MPI_CHECK(comm.speculative_collectives_slot() == 0, failed);
+  BOOST_MPI_COUNT_FAILED(test_gathers(comm, 10, 3), failed);
+  BOOST_MPI_COUNT_FAILED(test_broadcasts(comm, 10, 3), failed);
+  return failed;
+}
@@ -0,0 +1,108 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the gather that hands the values to a function at the
+// root as they arrive.
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+
+// Record what the root is given.
+template<typename T>
+struct collector
+{
+  collector(std::vector<T>& values, std::vector<int>& order)
+    : values(values), order(order) {}
+
+  void operator()(int source, const T& value) const
+  {
+    values[source] = value;
+    order.push_back(source);
+  }
+
+  std::vector<T>&   values;
+  std::vector<int>& order;
+};
+
+// Each source is seen once, the root first.
+bool
+check_order(const std::vector<int>& order, int size, int root)
+{
+  std::vector<int> seen(size, 0);
+  for (std::size_t i = 0; i < order.size(); ++i)
+    ++seen[order[i]];
+  return int(order.size()) == size && order[0] == root
+    && std::count(seen.begin(), seen.end(), 1) == size;
+}
+
+template<typename T>
+int
+test_gather(const communicator& comm, T (*generator)(int), int root, int window)
+{
+  int failed = 0;
+  int size = comm.size();
+  if (comm.rank() == root) {
+    std::vector<T> values(size);
+    std::vector<int> order;
+    collector<T> consume(values, order);
+    if (window > 0)
+      boost::mpi::streaming_gather(comm, generator(root), consume, root, window);
+    else
+      boost::mpi::streaming_gather(comm, generator(root), consume, root);
+    bool ok = check_order(order, size, root);
+    for (int p = 0; ok && p < size; ++p)
+      ok = values[p] == generator(p);
+    BOOST_MPI_CHECK(ok, failed);
+  } else {
+    boost::mpi::streaming_gather(comm, generator(comm.rank()), root);
+  }
+  return failed;
+}
+
+int
+int_generator(int p)
+{
+  return 3 * p + 1;
+}
+
+std::string
+string_generator(int p)
+{
+  return std::string(p % 5 * 7, char('a' + p % 26)) + boost::lexical_cast<std::string>(p);
+}
+
+// Large enough not to be sent eagerly.
+std::vector<double>
+vector_generator(int p)
+{
+  return std::vector<double>(20000 + 1000 * p, p / 2.0);
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  int last = world.size() - 1;
+  BOOST_MPI_COUNT_FAILED(test_gather(world, int_generator, 0, 0), failed);
+  BOOST_MPI_COUNT_FAILED(test_gather(world, int_generator, last, 1), failed);
+  BOOST_MPI_COUNT_FAILED(test_gather(world, string_generator, 0, 2), failed);
+  BOOST_MPI_COUNT_FAILED(test_gather(world, string_generator, last, 0), failed);
+  BOOST_MPI_COUNT_FAILED(test_gather(world, vector_generator, 0, 3), failed);
+  BOOST_MPI_COUNT_FAILED(test_gather(world, vector_generator, last, 1), failed);
+  return failed;
+}
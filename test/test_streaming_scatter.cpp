@@ -0,0 +1,94 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the scatter of values generated by the root one
+// destination at a time.
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <boost/lexical_cast.hpp>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+
+// Count the calls to the generator, which must be one per process.
+template<typename T>
+struct counting_generator
+{
+  counting_generator(T (*generator)(int), std::vector<int>& calls)
+    : generator(generator), calls(calls) {}
+
+  T operator()(int dest) const
+  {
+    ++calls[dest];
+    return generator(dest);
+  }
+
+  T (*generator)(int);
+  std::vector<int>& calls;
+};
+
+template<typename T>
+int
+test_scatter(const communicator& comm, T (*generator)(int), int root, int window)
+{
+  int failed = 0;
+  int size = comm.size();
+  T value;
+  if (comm.rank() == root) {
+    std::vector<int> calls(size, 0);
+    counting_generator<T> generate(generator, calls);
+    if (window > 0)
+      boost::mpi::streaming_scatter(comm, generate, value, root, window);
+    else
+      boost::mpi::streaming_scatter(comm, generate, value, root);
+    BOOST_MPI_CHECK(std::vector<int>(size, 1) == calls, failed);
+  } else {
+    boost::mpi::streaming_scatter(comm, value, root);
+  }
+  BOOST_MPI_CHECK(value == generator(comm.rank()), failed);
+  return failed;
+}
+
+int
+int_generator(int p)
+{
+  return 5 * p - 2;
+}
+
+std::string
+string_generator(int p)
+{
+  return boost::lexical_cast<std::string>(p) + std::string(p % 4 * 9, char('a' + p % 26));
+}
+
+// Large enough not to be sent eagerly.
+std::vector<int>
+vector_generator(int p)
+{
+  return std::vector<int>(40000 + 500 * p, -p);
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  int last = world.size() - 1;
+  BOOST_MPI_COUNT_FAILED(test_scatter(world, int_generator, 0, 0), failed);
+  BOOST_MPI_COUNT_FAILED(test_scatter(world, int_generator, last, 2), failed);
+  BOOST_MPI_COUNT_FAILED(test_scatter(world, string_generator, 0, 1), failed);
+  BOOST_MPI_COUNT_FAILED(test_scatter(world, string_generator, last, 0), failed);
+  BOOST_MPI_COUNT_FAILED(test_scatter(world, vector_generator, 0, 3), failed);
+  BOOST_MPI_COUNT_FAILED(test_scatter(world, vector_generator, last, 1), failed);
+  return failed;
+}
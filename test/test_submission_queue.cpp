@@ -0,0 +1,192 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the submission queue, through which worker threads
+// communicate without calling MPI themselves.
+#include <boost/mpi/submission_queue.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+
+#include "mpi_test_utils.hpp"
+
+#if defined(BOOST_MPI_HAS_SUBMISSION_QUEUE)
+
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using boost::mpi::communicator;
+using boost::mpi::status;
+using boost::mpi::submission_queue;
+
+int const nworkers = 4;
+int const nmessages = 50;
+
+// Each worker exchanges messages around the ring, on tags of its own.
+// It does not call MPI, not even to get the rank.
+void
+worker(submission_queue& queue, int rank, int size, int w,
+       std::atomic<int>& matched, std::atomic<int>& done)
+{
+  int right = (rank + 1) % size;
+  int left  = (rank + size - 1) % size;
+  std::vector<std::future<status> > sends;
+  std::vector<int> in(nmessages, -1);
+  std::vector<std::future<status> > recvs;
+  for (int i = 0; i < nmessages; ++i) {
+    int tag = w * nmessages + i;
+    recvs.push_back(queue.irecv(left, tag, in[i]));
+    sends.push_back(queue.isend(right, tag, rank * 1000 + tag));
+  }
+  std::future<std::string> s = queue.recv<std::string>(left, 100000 + w);
+  queue.isend(right, 100000 + w, boost::lexical_cast<std::string>(rank + w)).wait();
+  int ok = s.get() == boost::lexical_cast<std::string>(left + w);
+  for (int i = 0; i < nmessages; ++i) {
+    status st = recvs[i].get();
+    sends[i].get();
+    ok += st.source() == left && in[i] == left * 1000 + w * nmessages + i;
+  }
+  matched += ok;
+  ++done;
+}
+
+// The workers wait for their futures, while the main thread polls.
+int
+test_polled(const communicator& comm)
+{
+  int failed = 0;
+  submission_queue queue(comm);
+  std::atomic<int> matched(0);
+  std::atomic<int> done(0);
+  std::vector<std::thread> workers;
+  for (int w = 0; w < nworkers; ++w)
+    workers.push_back(std::thread(worker, std::ref(queue), comm.rank(), comm.size(), w,
+                                  std::ref(matched), std::ref(done)));
+  while (done < nworkers)
+    queue.poll();
+  for (int w = 0; w < nworkers; ++w)
+    workers[w].join();
+  BOOST_MPI_CHECK(matched == nworkers * (nmessages + 1), failed);
+  BOOST_MPI_CHECK(queue.pending() == 0, failed);
+  return failed;
+}
+
+// The broadcast does not block the queue: the other processes submit
+// it before the send the root waits for, before taking part.
+int
+test_broadcast(const communicator& comm)
+{
+  int failed = 0;
+  submission_queue queue(comm);
+  int value = comm.rank() == 0 ? 17 : -1;
+  if (comm.rank() == 0) {
+    std::vector<int> in(comm.size(), -1);
+    std::vector<std::future<status> > recvs;
+    for (int p = 1; p < comm.size(); ++p)
+      recvs.push_back(queue.irecv(p, 0, in[p]));
+    for (std::size_t i = 0; i < recvs.size(); ++i) {
+      while (recvs[i].wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        queue.poll();
+      BOOST_MPI_CHECK(in[i + 1] == int(i + 1), failed);
+    }
+  }
+  std::future<status> b = queue.broadcast(&value, 1, 0);
+  std::future<status> sent;
+  if (comm.rank() != 0)
+    sent = queue.isend(0, 0, comm.rank());
+  while (queue.pending() > 0)
+    queue.poll();
+  b.get();
+  BOOST_MPI_CHECK(value == 17, failed);
+  return failed;
+}
+
+std::string
+concat(const std::string& a, const std::string& b)
+{
+  return a + b;
+}
+
+// The queue runs a thread of its own.
+int
+test_thread(const communicator& comm)
+{
+  int failed = 0;
+  int rank = comm.rank();
+  int size = comm.size();
+  submission_queue queue(comm);
+  queue.start();
+  std::atomic<int> matched(0);
+  std::atomic<int> done(0);
+  std::vector<std::thread> workers;
+  for (int w = 0; w < nworkers; ++w)
+    workers.push_back(std::thread(worker, std::ref(queue), rank, size, w,
+                                  std::ref(matched), std::ref(done)));
+  for (int w = 0; w < nworkers; ++w)
+    workers[w].join();
+  BOOST_MPI_CHECK(matched == nworkers * (nmessages + 1), failed);
+
+  // Collectives, submitted in the same order everywhere.
+  std::future<int> sum = queue.all_reduce(rank, std::plus<int>());
+  std::future<std::string> all
+    = queue.all_reduce(boost::lexical_cast<std::string>(rank), concat);
+  int values[2] = { rank, -rank };
+  std::future<status> b = queue.broadcast(values, 2, size - 1);
+  std::future<status> barrier = queue.barrier();
+  BOOST_MPI_CHECK(sum.get() == size * (size - 1) / 2, failed);
+  std::string expected;
+  for (int p = 0; p < size; ++p)
+    expected += boost::lexical_cast<std::string>(p);
+  BOOST_MPI_CHECK(all.get() == expected, failed);
+  b.get();
+  BOOST_MPI_CHECK(values[0] == size - 1 && values[1] == 1 - size, failed);
+  barrier.get();
+
+  // A function runs in the thread of the queue, which passes its
+  // exceptions on.
+  std::future<int> submitted = queue.submit([](const communicator& c) { return c.size(); });
+  std::future<void> thrown = queue.submit([](const communicator&) {
+      throw std::runtime_error("submitted");
+    });
+  BOOST_MPI_CHECK(submitted.get() == size, failed);
+  bool caught = false;
+  try {
+    thrown.get();
+  } catch (std::runtime_error&) {
+    caught = true;
+  }
+  BOOST_MPI_CHECK(caught, failed);
+  queue.stop();
+  BOOST_MPI_CHECK(queue.pending() == 0, failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env(boost::mpi::threading::serialized);
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_polled(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_broadcast(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_thread(world), failed);
+  return failed;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,128 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the task pool, with the unbalanced search of a tree that
+// starts on a single process.
+#include <boost/mpi/task_pool.hpp>
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/serialization/string.hpp>
+#include <functional>
+#include <string>
+
+#include "mpi_test_utils.hpp"
+
+#if BOOST_MPI_VERSION >= 3
+
+using boost::mpi::communicator;
+using boost::mpi::task_pool;
+
+// A node of the tree, which knows its path from the root.
+struct node
+{
+  node() : depth(0) {}
+  node(int d, const std::string& p) : depth(d), path(p) {}
+
+  template<typename Archive>
+  void serialize(Archive& ar, const unsigned int)
+  {
+    ar & depth & path;
+  }
+
+  int depth;
+  std::string path;
+};
+
+// The nodes with a path ending in 'b' have one child less.
+struct search
+{
+  search(task_pool<node>& pool, int depth, unsigned long& bad)
+    : pool(&pool), depth(depth), bad(&bad) {}
+
+  void operator()(const node& n) const
+  {
+    if (int(n.path.size()) + n.depth != depth) {
+      ++*bad;
+    }
+    if (n.depth == 0) {
+      return;
+    }
+    pool->push(node(n.depth - 1, n.path + 'a'));
+    if (n.path.empty() || n.path[n.path.size() - 1] != 'b') {
+      pool->push(node(n.depth - 1, n.path + 'b'));
+    }
+  }
+
+  task_pool<node>* pool;
+  int depth;
+  unsigned long* bad;
+};
+
+// The number of nodes of the tree of the given depth, from a node
+// with two children.
+unsigned long
+nodes(int depth)
+{
+  // f(d) for a node with two children, g(d) for one with one.
+  unsigned long f = 1, g = 1;
+  for (int d = 1; d <= depth; ++d) {
+    unsigned long nf = 1 + f + g;
+    g = 1 + f;
+    f = nf;
+  }
+  return f;
+}
+
+int
+test_search(const communicator& comm, boost::mpi::steal_policy policy, int depth)
+{
+  int failed = 0;
+  task_pool<node> pool(comm, policy, 4);
+  // Run twice with the same pool.
+  for (int run = 0; run < 2; ++run) {
+    unsigned long bad = 0;
+    if (comm.rank() == 0) {
+      pool.push(node(depth, ""));
+    }
+    unsigned long before = pool.executed();
+    pool.run(search(pool, depth, bad));
+    BOOST_MPI_CHECK(pool.size() == 0 && bad == 0, failed);
+    unsigned long executed
+      = boost::mpi::all_reduce(comm, pool.executed() - before, std::plus<unsigned long>());
+    BOOST_MPI_CHECK(executed == nodes(depth), failed);
+  }
+  // Every task given was received.
+  unsigned long given = boost::mpi::all_reduce(comm, pool.given(), std::plus<unsigned long>());
+  unsigned long stolen = boost::mpi::all_reduce(comm, pool.stolen(), std::plus<unsigned long>());
+  BOOST_MPI_CHECK(given == stolen, failed);
+  if (comm.size() == 1) {
+    BOOST_MPI_CHECK(pool.steals() == 0, failed);
+  }
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_search(world, boost::mpi::steal_random, 14), failed);
+  BOOST_MPI_COUNT_FAILED(test_search(world, boost::mpi::steal_local_first, 14), failed);
+  // Nothing but the root.
+  BOOST_MPI_COUNT_FAILED(test_search(world, boost::mpi::steal_random, 0), failed);
+  return failed;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
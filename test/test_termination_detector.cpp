@@ -0,0 +1,123 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the termination detector, with tokens passed around at
+// random until they expire.
+#include <boost/mpi/termination_detector.hpp>
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::mpi::request;
+using boost::mpi::status;
+using boost::mpi::termination_detector;
+
+int const ntokens = 10;
+int const lifetime = 20;
+
+// Pass a token on, if it has not expired.
+void
+pass(const communicator& comm, termination_detector& detector,
+     std::vector<request>& sends, int token)
+{
+  if (token > 0) {
+    sends.push_back(comm.isend(std::rand() % comm.size(), 0, token - 1));
+    detector.sent();
+  }
+}
+
+// Check that all the tokens have been handled when the detector says so.
+int
+check(const communicator& comm, termination_detector& detector,
+      std::vector<request>& sends, unsigned long handled)
+{
+  int failed = 0;
+  BOOST_MPI_CHECK(detector.terminated(), failed);
+  BOOST_MPI_CHECK(detector.waves() >= 2, failed);
+  boost::mpi::wait_all(sends.begin(), sends.end());
+  // Each token is handled lifetime + 1 times.
+  unsigned long total = boost::mpi::all_reduce(comm, handled, std::plus<unsigned long>());
+  BOOST_MPI_CHECK(total == (unsigned long)(comm.size() * ntokens * (lifetime + 1)), failed);
+  BOOST_MPI_CHECK(!comm.iprobe(boost::mpi::any_source, 0), failed);
+  return failed;
+}
+
+// The process probes for tokens, and tests the detector when there are
+// none.
+int
+test_polled(const communicator& comm)
+{
+  termination_detector detector(comm);
+  std::vector<request> sends;
+  unsigned long handled = 0;
+  for (int i = 0; i < ntokens; ++i) {
+    // The tokens given at the start were not sent, nor received.
+    ++handled;
+    pass(comm, detector, sends, lifetime);
+  }
+  for (;;) {
+    if (boost::optional<status> s = comm.iprobe(boost::mpi::any_source, 0)) {
+      int token;
+      comm.recv(s->source(), 0, token);
+      detector.received();
+      ++handled;
+      pass(comm, detector, sends, token);
+    } else if (detector.test()) {
+      break;
+    }
+  }
+  int failed = check(comm, detector, sends, handled);
+  comm.barrier();
+  return failed;
+}
+
+// The process waits for either a token or the end.
+int
+test_wait_any(const communicator& comm)
+{
+  termination_detector detector(comm);
+  std::vector<request> sends;
+  unsigned long handled = 0;
+  for (int i = 0; i < ntokens; ++i) {
+    ++handled;
+    pass(comm, detector, sends, lifetime);
+  }
+  int token;
+  request reqs[2] = { comm.irecv(boost::mpi::any_source, 0, token), detector.get_request() };
+  while (boost::mpi::wait_any(reqs, reqs + 2).second == reqs) {
+    detector.received();
+    ++handled;
+    pass(comm, detector, sends, token);
+    reqs[0] = comm.irecv(boost::mpi::any_source, 0, token);
+  }
+  int failed = check(comm, detector, sends, handled);
+  // Complete the last receive.
+  comm.send(comm.rank(), 0, 0);
+  reqs[0].wait();
+  BOOST_MPI_CHECK(token == 0, failed);
+  comm.barrier();
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+  std::srand(world.rank() + 1);
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_polled(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_wait_any(world), failed);
+  return failed;
+}
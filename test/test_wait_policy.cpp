@@ -0,0 +1,180 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the wait policies of wait_any, wait_all and wait_some,
+// with a mix of plain and serialized requests.
+#include <boost/mpi/wait_policy.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::mpi::request;
+using boost::mpi::status;
+using boost::mpi::wait_policy;
+
+std::string
+value(int rank, int i)
+{
+  return boost::lexical_cast<std::string>(rank) + std::string(i * 1000, 'v');
+}
+
+// Exchange plain and serialized values around the ring, and wait for
+// them with each function.
+int
+test_exchanges(const communicator& comm, const wait_policy& policy)
+{
+  int failed = 0;
+  int right = (comm.rank() + 1) % comm.size();
+  int left  = (comm.rank() + comm.size() - 1) % comm.size();
+  int const n = 4;
+
+  for (int variant = 0; variant < 3; ++variant) {
+    std::vector<request> reqs;
+    std::vector<std::string> in(n);
+    std::vector<int> numbers(n, -1);
+    for (int i = 0; i < n; ++i) {
+      reqs.push_back(comm.irecv(left, i, in[i]));
+      reqs.push_back(comm.irecv(left, n + i, numbers[i]));
+    }
+    std::vector<request> sends;
+    for (int i = 0; i < n; ++i) {
+      sends.push_back(comm.isend(right, i, value(comm.rank(), i)));
+      sends.push_back(comm.isend(right, n + i, comm.rank() + i));
+    }
+    if (variant == 0) {
+      std::vector<status> stats;
+      boost::mpi::wait_all(reqs.begin(), reqs.end(), std::back_inserter(stats), policy);
+      BOOST_MPI_CHECK(stats.size() == reqs.size(), failed);
+    } else if (variant == 1) {
+      // Wait for each one in turn.
+      for (std::size_t k = 0; k < reqs.size(); ++k) {
+        std::vector<request>::iterator last = reqs.end() - k;
+        std::pair<status, std::vector<request>::iterator> r
+          = boost::mpi::wait_any(reqs.begin(), last, policy);
+        std::swap(*r.second, *(last - 1));
+      }
+    } else {
+      std::vector<request>::iterator pending = reqs.end();
+      while (pending != reqs.begin()) {
+        std::vector<status> stats;
+        std::vector<request>::iterator done
+          = boost::mpi::wait_some(reqs.begin(), pending, std::back_inserter(stats), policy).second;
+        BOOST_MPI_CHECK(std::size_t(pending - done) == stats.size() && !stats.empty(), failed);
+        pending = done;
+      }
+    }
+    boost::mpi::wait_all(sends.begin(), sends.end(), policy);
+    bool ok = true;
+    for (int i = 0; i < n; ++i)
+      ok = ok && in[i] == value(left, i) && numbers[i] == left + i;
+    BOOST_MPI_CHECK(ok, failed);
+  }
+  return failed;
+}
+
+// A serialized receive whose archive is too large to be sent eagerly,
+// with a plain receive that only completes after it: blocking on the
+// plain receive would keep the archive from ever being received.
+int
+test_rendezvous(const communicator& comm, const wait_policy& policy)
+{
+  int failed = 0;
+  if (comm.size() < 2 || comm.rank() > 1) {
+    return failed;
+  }
+  std::string const large(16 << 20, 'r');
+  for (int variant = 0; variant < 2; ++variant) {
+    if (comm.rank() == 0) {
+      std::string in;
+      int number = -1;
+      request reqs[2];
+      reqs[0] = comm.irecv(1, 0, in);
+      reqs[1] = comm.irecv(1, 1, number);
+      if (variant == 0) {
+        boost::mpi::wait_all(reqs, reqs + 2, policy);
+      } else {
+        request* pending = reqs + 2;
+        while (pending != reqs) {
+          pending = boost::mpi::wait_some(reqs, pending, policy);
+        }
+      }
+      BOOST_MPI_CHECK(in == large && number == 42, failed);
+    } else {
+      comm.send(0, 0, large);
+      comm.send(0, 1, 42);
+    }
+  }
+  return failed;
+}
+
+int
+test_policies(const communicator& comm)
+{
+  int failed = 0;
+  // The default comes from BOOST_MPI_WAIT_POLICY, which is not set.
+  BOOST_MPI_CHECK(boost::mpi::default_wait_policy().strategy == boost::mpi::wait_spin, failed);
+
+  BOOST_MPI_COUNT_FAILED(test_exchanges(comm, wait_policy(boost::mpi::wait_spin)), failed);
+  BOOST_MPI_COUNT_FAILED(test_exchanges(comm, wait_policy(boost::mpi::wait_yield)), failed);
+  BOOST_MPI_COUNT_FAILED(test_exchanges(comm, wait_policy(boost::mpi::wait_backoff, 2, 50)), failed);
+  BOOST_MPI_COUNT_FAILED(test_exchanges(comm, wait_policy(boost::mpi::wait_block)), failed);
+  BOOST_MPI_COUNT_FAILED(test_rendezvous(comm, wait_policy(boost::mpi::wait_spin)), failed);
+  BOOST_MPI_COUNT_FAILED(test_rendezvous(comm, wait_policy(boost::mpi::wait_block)), failed);
+
+  // The default policy is used by the calls without one.
+  boost::mpi::set_default_wait_policy(wait_policy(boost::mpi::wait_backoff, 8, 20));
+  BOOST_MPI_CHECK(boost::mpi::default_wait_policy().spins == 8, failed);
+  std::string in;
+  request reqs[2];
+  reqs[0] = comm.irecv(comm.rank(), 0, in);
+  reqs[1] = comm.isend(comm.rank(), 0, value(comm.rank(), 3));
+  boost::mpi::wait_all(reqs, reqs + 2);
+  BOOST_MPI_CHECK(in == value(comm.rank(), 3), failed);
+  boost::mpi::set_default_wait_policy(wait_policy());
+  return failed;
+}
+
+int
+test_statistics()
+{
+  int failed = 0;
+  boost::mpi::reset_wait_statistics();
+  boost::mpi::wait_statistics stats = boost::mpi::get_wait_statistics();
+  BOOST_MPI_CHECK(stats.waits == 0 && stats.polls == 0 && stats.blocks == 0, failed);
+  {
+    boost::mpi::detail::waiter w(wait_policy(boost::mpi::wait_block, 2));
+    // Within the spins, then nothing to block on, then blocking.
+    BOOST_MPI_CHECK(!w.pause(true) && !w.pause(true), failed);
+    BOOST_MPI_CHECK(!w.pause(false) && w.pause(true), failed);
+  }
+  {
+    // A wait without unsuccessful passes is not counted.
+    boost::mpi::detail::waiter w(wait_policy(boost::mpi::wait_backoff));
+  }
+  stats = boost::mpi::get_wait_statistics();
+  BOOST_MPI_CHECK(stats.waits == 1 && stats.polls == 4 && stats.blocks == 1, failed);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_COUNT_FAILED(test_policies(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_statistics(), failed);
+  return failed;
+}
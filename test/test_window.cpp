@@ -0,0 +1,153 @@
+// Copyright (C) 2026 Boost.MPI Developers
+
+// Use, modification and distribution is subject to the Boost Software
+// License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// A test of the one-sided communication windows, with active and
+// passive target synchronization.
+#include <boost/mpi/window.hpp>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/operations.hpp>
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "mpi_test_utils.hpp"
+
+using boost::mpi::communicator;
+using boost::mpi::window;
+
+#if BOOST_MPI_VERSION >= 3
+
+int
+test_active_target(const communicator& world)
+{
+  int failed = 0;
+  int size = world.size();
+  int rank = world.rank();
+  int right = (rank + 1) % size;
+  int left  = (rank + size - 1) % size;
+
+  // Existing memory: everybody writes its rank in the first slot of
+  // its right neighbor, and reads the second slot of its left one.
+  std::vector<int> slots(2, -1);
+  slots[1] = 10 * rank;
+  window<int> win(world, &slots[0], slots.size());
+  BOOST_MPI_CHECK(win.data() == &slots[0] && win.size() == 2, failed);
+  int from_left = -1;
+  win.fence();
+  win.put(right, 0, rank);
+  win.get(left, 1, from_left);
+  win.fence();
+  BOOST_MPI_CHECK(slots[0] == left && from_left == 10 * left, failed);
+
+  // Everybody counts itself on every process.
+  std::vector<int> counts(size, 0);
+  window<int> counters(world, &counts[0], counts.size());
+  counters.fence();
+  for (int p = 0; p < size; ++p) {
+    counters.accumulate(p, rank, 1, std::plus<int>());
+    counters.accumulate(p, rank, 2, boost::mpi::maximum<int>());
+  }
+  counters.fence();
+  bool ok = true;
+  for (int p = 0; p < size; ++p)
+    ok = ok && counts[p] == 2;
+  BOOST_MPI_CHECK(ok, failed);
+  return failed;
+}
+
+int
+test_passive_target(const communicator& world)
+{
+  int failed = 0;
+  int size = world.size();
+  int rank = world.rank();
+
+  // A shared counter on process 0, allocated by MPI.
+  window<long> counter(world, rank == 0 ? 1 : 0);
+  BOOST_MPI_CHECK(bool(counter) && counter.size() == (rank == 0 ? 1u : 0u), failed);
+  if (rank == 0) {
+    counter.lock(0, boost::mpi::lock_exclusive);
+    counter.data()[0] = 0;
+    counter.unlock(0);
+  }
+  world.barrier();
+  counter.lock_all();
+  long ticket = counter.fetch_and_op(0, 0, 1L, std::plus<long>());
+  counter.unlock_all();
+  std::vector<long> tickets;
+  boost::mpi::all_gather(world, ticket, tickets);
+  std::vector<bool> seen(size, false);
+  for (int p = 0; p < size; ++p) {
+    if (tickets[p] >= 0 && tickets[p] < size)
+      seen[tickets[p]] = true;
+  }
+  BOOST_MPI_CHECK(std::find(seen.begin(), seen.end(), false) == seen.end(), failed);
+
+  // Only one process wins the compare and swap.
+  window<int> flag(world, 1);
+  flag.data()[0] = -1;
+  world.barrier();
+  flag.lock(0);
+  int previous = flag.compare_and_swap(0, 0, rank, -1);
+  flag.unlock(0);
+  int winners = boost::mpi::all_reduce(world, previous == -1 ? 1 : 0, std::plus<int>());
+  BOOST_MPI_CHECK(winners == 1, failed);
+
+  // Request based operations
+  window<double> values(world, 4);
+  for (int i = 0; i < 4; ++i)
+    values.data()[i] = rank + i / 4.0;
+  world.barrier();
+  int target = (rank + 1) % size;
+  double got[4];
+  double mine[2] = { -1.0, -2.0 };
+  values.lock_all();
+  boost::mpi::request reqs[2];
+  reqs[0] = values.rget(target, 0, got, 2);
+  reqs[1] = values.rget(target, 2, got + 2, 2);
+  boost::mpi::wait_all(reqs, reqs + 2);
+  values.unlock_all();
+  bool ok = true;
+  for (int i = 0; i < 4; ++i)
+    ok = ok && got[i] == target + i / 4.0;
+  BOOST_MPI_CHECK(ok, failed);
+
+  world.barrier();
+  values.lock(target, boost::mpi::lock_exclusive);
+  boost::mpi::request put = values.rput(target, 2, mine, 2);
+  put.wait();
+  values.unlock(target);
+  world.barrier();
+  values.lock(rank);
+  values.sync();
+  BOOST_MPI_CHECK(values.data()[2] == -1.0 && values.data()[3] == -2.0, failed);
+  values.unlock(rank);
+  return failed;
+}
+
+int main()
+{
+  boost::mpi::environment env;
+  communicator world;
+
+  int failed = 0;
+  BOOST_MPI_CHECK(!window<int>() && MPI_Win(window<int>()) == MPI_WIN_NULL, failed);
+  BOOST_MPI_COUNT_FAILED(test_active_target(world), failed);
+  BOOST_MPI_COUNT_FAILED(test_passive_target(world), failed);
+  return failed;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif